@@ -0,0 +1,133 @@
+/**
+ * @brief 通过SQL比较按列布局与按行布局的插入和带条件查询速度。
+ * 两表结构相同，按列布局的表由CREATE TABLE ... WITH (layout=columnar)创建。
+ * 记录含一个较宽的字符串列而条件只涉及一个整数列，
+ * 按列布局求值条件时只需读取该列所在的小页。
+ * 最后检查一行放不进一个页面的表不能使用按列布局，
+ * 而同样宽的按行布局表能存入并原样读回超过一个页面的字符串。
+ *
+ * 用法：thdb_columnar_layout_bench [记录数]
+ */
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "backend/backend.h"
+#include "system/instance.h"
+
+using namespace thdb;
+
+const Size INSERT_BATCH = 500;
+const Size SELECT_ROUNDS = 5;
+
+double Seconds(std::chrono::steady_clock::time_point iBegin) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                       iBegin)
+      .count();
+}
+
+/**
+ * @brief 执行SQL语句，返回最后一个结果的记录数
+ */
+Size Run(Instance *pDB, const String &sSQL) {
+  Size nSize = 0;
+  for (const auto &pResult : Execute(pDB, sSQL)) {
+    nSize = pResult->GetSize();
+    delete pResult;
+  }
+  return nSize;
+}
+
+/**
+ * @brief 执行只返回一个整数的语句，如CREATE TABLE，返回该整数
+ */
+int RunStatus(Instance *pDB, const String &sSQL) {
+  int nStatus = 0;
+  for (const auto &pResult : Execute(pDB, sSQL)) {
+    std::vector<String> iRow = pResult->ToVector();
+    if (!iRow.empty()) nStatus = atoi(iRow[0].c_str());
+    delete pResult;
+  }
+  return nStatus;
+}
+
+void Measure(const String &sName, const String &sOption, Size nRecords) {
+  Instance *pDB = new Instance();
+  if (RunStatus(pDB, "CREATE TABLE " + sName +
+                         "(id INT, grp INT, score FLOAT, note VARCHAR(64))" +
+                         sOption + ";") != 1)
+    printf("warning: CREATE TABLE %s failed\n", sName.c_str());
+  auto iBegin = std::chrono::steady_clock::now();
+  for (Size i = 0; i < nRecords; i += INSERT_BATCH) {
+    String sSQL = "INSERT INTO " + sName + " VALUES ";
+    for (Size j = i; j < nRecords && j < i + INSERT_BATCH; ++j) {
+      if (j > i) sSQL += ",";
+      sSQL += "(" + std::to_string(j) + "," + std::to_string(j % 100) + "," +
+              std::to_string(j * 0.5) + ",'note " + std::to_string(j) + "')";
+    }
+    Run(pDB, sSQL + ";");
+  }
+  double fInsert = Seconds(iBegin);
+  delete pDB;
+  Close();
+
+  pDB = new Instance();
+  iBegin = std::chrono::steady_clock::now();
+  Size nMatched = 0;
+  for (Size i = 0; i < SELECT_ROUNDS; ++i)
+    nMatched += Run(pDB, "SELECT * FROM " + sName + " WHERE " + sName +
+                             ".grp >= 90;");
+  double fSelect = Seconds(iBegin);
+  Run(pDB, "DROP TABLE " + sName + ";");
+  delete pDB;
+  Close();
+
+  if (nMatched != nRecords / 10 * SELECT_ROUNDS)
+    printf("warning: unexpected result count\n");
+  printf("%9s %12.0f %16.0f\n", sName.c_str(), nRecords / fInsert,
+         nRecords * SELECT_ROUNDS / fSelect);
+}
+
+int main(int argc, char **argv) {
+  Size nRecords = (argc > 1) ? atoi(argv[1]) : 100000;
+  printf("records: %u\n", nRecords);
+  printf("%9s %12s %16s\n", "layout", "insert/s", "select rows/s");
+  String sDir = "columnar_layout_bench";
+  mkdir(sDir.c_str(), 0755);
+  if (chdir(sDir.c_str()) < 0) return 1;
+  Clear();
+  Init();
+  Measure("rowwise", " WITH (layout=row)", nRecords);
+  Measure("columnar", " WITH (layout=columnar)", nRecords);
+
+  Instance *pDB = new Instance();
+  int nWide = RunStatus(pDB,
+                        "CREATE TABLE wide(id INT, body VARCHAR(40000)) "
+                        "WITH (layout=columnar);");
+  printf("wide columnar table %s\n", nWide ? "accepted (unexpected)"
+                                           : "rejected");
+  RunStatus(pDB, "CREATE TABLE wide(id INT, body VARCHAR(40000));");
+  String sBody(20000, 'w');
+  Run(pDB, "INSERT INTO wide VALUES (1,'" + sBody + "');");
+  delete pDB;
+  Close();
+
+  pDB = new Instance();
+  bool bMatched = false;
+  for (const auto &pResult : Execute(pDB, "SELECT * FROM wide;")) {
+    std::vector<String> iRow = pResult->ToVector();
+    bMatched = (iRow.size() == 1 && iRow[0] == "1," + sBody);
+    delete pResult;
+  }
+  printf("wide row table round trip %s\n", bMatched ? "ok" : "FAILED");
+  Run(pDB, "DROP TABLE wide;");
+  delete pDB;
+  Close();
+  Clear();
+  if (chdir("..") < 0) return 1;
+  rmdir(sDir.c_str());
+  return 0;
+}
@@ -0,0 +1,109 @@
+/**
+ * @brief 比较定长布局与按行布局的插入、扫描和按位置读取速度。
+ * 只含数值列的表自动使用定长布局；作为对照的按行布局表在相同的数值列之外
+ * 多一个始终为空的字符串列，使其保持ToastPage存放，两表的数值数据完全相同。
+ * 插入后重新打开数据库，分别测量全表扫描、带条件扫描和按位置读取记录的速度。
+ *
+ * 用法：thdb_fixed_layout_bench [记录数] [读取次数]
+ */
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+#include "backend/backend.h"
+#include "condition/conditions.h"
+#include "minios/os.h"
+#include "record/record.h"
+#include "system/instance.h"
+
+using namespace thdb;
+
+const Size SCAN_ROUNDS = 5;
+
+double Seconds(std::chrono::steady_clock::time_point iBegin) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                       iBegin)
+      .count();
+}
+
+std::vector<Column> BenchColumns(bool bFixed) {
+  std::vector<Column> iColVec({Column("id", FieldType::INT_TYPE),
+                               Column("grp", FieldType::INT_TYPE),
+                               Column("score", FieldType::FLOAT_TYPE)});
+  if (!bFixed) iColVec.push_back(Column("pad", FieldType::STRING_TYPE, 1));
+  return iColVec;
+}
+
+void Measure(const String &sName, bool bFixed, Size nRecords, Size nReads) {
+  std::vector<std::vector<String>> iRows;
+  for (Size i = 0; i < nRecords; ++i) {
+    std::vector<String> iRow({std::to_string(i), std::to_string(i % 100),
+                              std::to_string(i * 0.5)});
+    if (!bFixed) iRow.push_back("''");
+    iRows.push_back(iRow);
+  }
+  Instance *pDB = new Instance();
+  pDB->CreateTable(sName, Schema(BenchColumns(bFixed)));
+  auto iBegin = std::chrono::steady_clock::now();
+  std::vector<PageSlotID> iPairs = pDB->InsertMany(sName, iRows);
+  double fInsert = Seconds(iBegin);
+  delete pDB;
+  Close();
+
+  pDB = new Instance();
+  iBegin = std::chrono::steady_clock::now();
+  Size nScanned = 0;
+  for (Size i = 0; i < SCAN_ROUNDS; ++i)
+    nScanned += pDB->Search(sName, nullptr, {}).size();
+  double fScan = Seconds(iBegin);
+
+  iBegin = std::chrono::steady_clock::now();
+  Size nMatched = 0;
+  for (Size i = 0; i < SCAN_ROUNDS; ++i) {
+    RangeCondition iCond(1, 10, 20);
+    nMatched += pDB->Search(sName, &iCond, {}).size();
+  }
+  double fFilter = Seconds(iBegin);
+
+  std::mt19937 iRandom(2021);
+  std::uniform_int_distribution<Size> iPos(0, nRecords - 1);
+  iBegin = std::chrono::steady_clock::now();
+  for (Size i = 0; i < nReads; ++i) {
+    Record *pRecord = pDB->GetRecord(sName, iPairs[iPos(iRandom)]);
+    delete pRecord;
+  }
+  double fRead = Seconds(iBegin);
+  pDB->DropTable(sName);
+  delete pDB;
+  Close();
+
+  if (nScanned != nRecords * SCAN_ROUNDS ||
+      nMatched != nRecords / 10 * SCAN_ROUNDS)
+    printf("warning: unexpected result count\n");
+  printf("%8s %12.0f %12.0f %13.0f %12.0f\n", sName.c_str(),
+         nRecords / fInsert, nScanned / fScan, nScanned / fFilter,
+         nReads / fRead);
+}
+
+int main(int argc, char **argv) {
+  Size nRecords = (argc > 1) ? atoi(argv[1]) : 200000;
+  Size nReads = (argc > 2) ? atoi(argv[2]) : 100000;
+  printf("records: %u, reads: %u\n", nRecords, nReads);
+  printf("%8s %12s %12s %13s %12s\n", "layout", "insert/s", "scan rows/s",
+         "filter rows/s", "read/s");
+  String sDir = "fixed_layout_bench";
+  mkdir(sDir.c_str(), 0755);
+  if (chdir(sDir.c_str()) < 0) return 1;
+  Clear();
+  Init();
+  Measure("fixed", true, nRecords, nReads);
+  Measure("row", false, nRecords, nReads);
+  Clear();
+  if (chdir("..") < 0) return 1;
+  rmdir(sDir.c_str());
+  return 0;
+}
@@ -0,0 +1,104 @@
+/**
+ * @brief 比较不同页面大小下顺序扫描与索引点查的吞吐量。
+ * 每种页面大小在独立的目录中新建数据库，插入相同的数据后重新打开数据库，
+ * 分别测量全表扫描和按主键点查（索引查找并读出记录）的速度。
+ *
+ * 用法：thdb_page_size_bench [记录数] [点查次数]
+ */
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+#include "backend/backend.h"
+#include "condition/conditions.h"
+#include "field/fields.h"
+#include "index/index.h"
+#include "minios/os.h"
+#include "record/record.h"
+#include "system/instance.h"
+
+using namespace thdb;
+
+const Size BENCH_PAGE_SIZES[] = {4096, 8192, 16384, 32768};
+const Size SCAN_ROUNDS = 5;
+
+double Seconds(std::chrono::steady_clock::time_point iBegin) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                       iBegin)
+      .count();
+}
+
+void Load(Size nRecords) {
+  Instance *pDB = new Instance();
+  pDB->CreateTable("bench", Schema({Column("id", FieldType::INT_TYPE),
+                                    Column("score", FieldType::FLOAT_TYPE),
+                                    Column("name", FieldType::STRING_TYPE,
+                                           32)}));
+  pDB->CreateIndex("bench", "id", FieldType::INT_TYPE);
+  for (Size i = 0; i < nRecords; ++i) {
+    pDB->Insert("bench", {std::to_string(i), std::to_string(i * 0.5),
+                          "'name" + std::to_string(i) + "'"});
+  }
+  delete pDB;
+  Close();
+}
+
+void Measure(Size nPageSize, Size nRecords, Size nLookups) {
+  auto iBegin = std::chrono::steady_clock::now();
+  Load(nRecords);
+  double fLoad = Seconds(iBegin);
+
+  Instance *pDB = new Instance();
+  iBegin = std::chrono::steady_clock::now();
+  Size nScanned = 0;
+  for (Size i = 0; i < SCAN_ROUNDS; ++i)
+    nScanned += pDB->Search("bench", nullptr, {}).size();
+  double fScan = Seconds(iBegin);
+
+  std::mt19937 iRandom(2021);
+  std::uniform_int_distribution<int> iKey(0, (int)nRecords - 1);
+  Index *pIndex = pDB->GetIndex("bench", "id");
+  Size nFound = 0;
+  iBegin = std::chrono::steady_clock::now();
+  for (Size i = 0; i < nLookups; ++i) {
+    int nKey = iKey(iRandom);
+    IntField iLow(nKey), iHigh(nKey + 1);
+    for (const auto &iPair : pIndex->Range(&iLow, &iHigh)) {
+      Record *pRecord = pDB->GetRecord("bench", iPair);
+      delete pRecord;
+      ++nFound;
+    }
+  }
+  double fLookup = Seconds(iBegin);
+  delete pDB;
+  Close();
+
+  if (nScanned != nRecords * SCAN_ROUNDS || nFound != nLookups)
+    printf("warning: unexpected result count\n");
+  printf("%9u %12.0f %12.0f %12.0f\n", nPageSize, nRecords / fLoad,
+         nScanned / fScan, nLookups / fLookup);
+}
+
+int main(int argc, char **argv) {
+  Size nRecords = (argc > 1) ? atoi(argv[1]) : 100000;
+  Size nLookups = (argc > 2) ? atoi(argv[2]) : 20000;
+  printf("records: %u, lookups: %u\n", nRecords, nLookups);
+  printf("%9s %12s %12s %12s\n", "page_size", "insert/s", "scan rows/s",
+         "lookup/s");
+  for (Size nPageSize : BENCH_PAGE_SIZES) {
+    String sDir = "page_size_bench_" + std::to_string(nPageSize);
+    mkdir(sDir.c_str(), 0755);
+    if (chdir(sDir.c_str()) < 0) return 1;
+    Clear();
+    Init(nPageSize);
+    Measure(nPageSize, nRecords, nLookups);
+    Clear();
+    if (chdir("..") < 0) return 1;
+    rmdir(sDir.c_str());
+  }
+  return 0;
+}
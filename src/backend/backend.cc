@@ -24,16 +24,17 @@ bool Exists() {
     return false;
 }
 
-void Init() {
+void Init(Size nPageSize) {
   if (Exists()) return;
   printf("Database Init.\n");
+  MiniOS::SetPageSize(nPageSize);
 
-  RecordPage *pNotUsed1 = new RecordPage(256, true);
-  RecordPage *pNotUsed2 = new RecordPage(256, true);
-  RecordPage *pTableManagerPage = new RecordPage(TABLE_NAME_SIZE + 4, true);
-  RecordPage *pIndexManagerPage = new RecordPage(128, true);
+  RecordPage *pNotUsed1 = new RecordPage(256, NEW_PAGE);
+  RecordPage *pNotUsed2 = new RecordPage(256, NEW_PAGE);
+  RecordPage *pTableManagerPage = new RecordPage(TABLE_NAME_SIZE + 4, NEW_PAGE);
+  RecordPage *pIndexManagerPage = new RecordPage(128, NEW_PAGE);
   RecordPage *pRecoverManagerPage =
-      new RecordPage(TABLE_NAME_SIZE + 4 + 4, true);
+      new RecordPage(TABLE_NAME_SIZE + 4 + 4, NEW_PAGE);
 
   printf("Build Finish.\n");
 
@@ -69,7 +70,10 @@ std::vector<Result *> Execute(Instance *pDB, const String &sSQL) {
   auto iTree = iParser.program();
   delete pListener;
   SystemVisitor iVisitor{pDB};
-  return iVisitor.visit(iTree);
+  std::vector<Result *> iResVec = iVisitor.visit(iTree);
+  // 删除语句登记的自动整理在全部语句执行完后进行，不计入语句本身
+  pDB->RunDeferred();
+  return iResVec;
 }
 
 }  // namespace thdb
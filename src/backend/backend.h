@@ -3,12 +3,17 @@
 
 #include "defines.h"
 #include "result/results.h"
+#include "settings.h"
 #include "system/instance.h"
 
 namespace thdb {
 
 bool Exists();
-void Init();
+/**
+ * @brief 创建数据库
+ * @param nPageSize 页面大小，创建后不可更改
+ */
+void Init(Size nPageSize = DEFAULT_PAGE_SIZE);
 void Close();
 void Clear();
 void Help();
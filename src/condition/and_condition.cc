@@ -21,4 +21,22 @@ bool AndCondition::Match(const Record &iRecord) const {
   return true;
 }
 
+bool AndCondition::Match(const RecordView &iView) const {
+  for (auto it = _iCondVec.begin(); it != _iCondVec.end(); ++it) {
+    if ((*it)->Match(iView))
+      continue;
+    else
+      return false;
+  }
+  return true;
+}
+
+bool AndCondition::Compile(RecordFilter *pFilter) const {
+  Size nBegin = pFilter->Begin(FilterOp::AND);
+  for (const auto &pCond : _iCondVec)
+    if (!pCond->Compile(pFilter)) return false;
+  pFilter->End(nBegin);
+  return true;
+}
+
 }  // namespace thdb
@@ -11,6 +11,8 @@ class AndCondition : public Condition {
   AndCondition(const std::vector<Condition *> &iCondVec);
   ~AndCondition();
   bool Match(const Record &iRecord) const override;
+  bool Match(const RecordView &iView) const override;
+  bool Compile(RecordFilter *pFilter) const override;
   void PushBack(Condition *pCond);
 
  private:
@@ -2,6 +2,15 @@
 
 namespace thdb {
 
+bool Condition::Match(const RecordView &iView) const {
+  Record *pRecord = iView.ToRecord();
+  bool bMatch = Match(*pRecord);
+  delete pRecord;
+  return bMatch;
+}
+
+bool Condition::Compile(RecordFilter *pFilter) const { return false; }
+
 ConditionType Condition::GetType() const { return ConditionType::SIMPLE_TYPE; }
 
 }  // namespace thdb
@@ -2,6 +2,8 @@
 #define THDB_CONDITION_H_
 
 #include "record/record.h"
+#include "record/record_filter.h"
+#include "record/record_view.h"
 
 namespace thdb {
 
@@ -22,6 +24,20 @@ class Condition {
    * @return false 不符合
    */
   virtual bool Match(const Record &iRecord) const = 0;
+  /**
+   * @brief 直接在记录视图上判断是否符合当前条件。
+   * 默认实现先将视图解码为完整记录，子类应尽量直接读取所需的列。
+   *
+   * @param iView 记录视图
+   */
+  virtual bool Match(const RecordView &iView) const;
+  /**
+   * @brief 将条件编译到字节级过滤器中
+   *
+   * @param pFilter 目标过滤器
+   * @return false 条件无法编译，需要回退到Match
+   */
+  virtual bool Compile(RecordFilter *pFilter) const;
   virtual ConditionType GetType() const;
 };
 
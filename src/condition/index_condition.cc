@@ -28,6 +28,13 @@ IndexCondition::~IndexCondition() {
 
 bool IndexCondition::Match(const Record &iRecord) const { return true; }
 
+bool IndexCondition::Match(const RecordView &iView) const { return true; }
+
+bool IndexCondition::Compile(RecordFilter *pFilter) const {
+  pFilter->AddConst(true);
+  return true;
+}
+
 ConditionType IndexCondition::GetType() const {
   return ConditionType::INDEX_TYPE;
 }
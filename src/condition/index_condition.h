@@ -13,6 +13,8 @@ class IndexCondition : public Condition {
   ~IndexCondition();
 
   bool Match(const Record &iRecord) const override;
+  bool Match(const RecordView &iView) const override;
+  bool Compile(RecordFilter *pFilter) const override;
   ConditionType GetType() const override;
 
   std::pair<String, String> GetIndexName() const;
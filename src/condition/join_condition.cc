@@ -12,6 +12,13 @@ JoinCondition::JoinCondition(const String &sTableA, const String &sColA,
 
 bool JoinCondition::Match(const Record &iRecord) const { return true; }
 
+bool JoinCondition::Match(const RecordView &iView) const { return true; }
+
+bool JoinCondition::Compile(RecordFilter *pFilter) const {
+  pFilter->AddConst(true);
+  return true;
+}
+
 ConditionType JoinCondition::GetType() const {
   return ConditionType::JOIN_TYPE;
 }
@@ -12,6 +12,8 @@ class JoinCondition : public Condition {
                 const String &sTableB, const String &sColB);
   ~JoinCondition() = default;
   bool Match(const Record &iRecord) const override;
+  bool Match(const RecordView &iView) const override;
+  bool Compile(RecordFilter *pFilter) const override;
   ConditionType GetType() const override;
   String sTableA, sTableB;
   String sColA, sColB;
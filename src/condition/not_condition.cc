@@ -9,4 +9,15 @@ bool NotCondition::Match(const Record &iRecord) const {
   return !_pCond->Match(iRecord);
 }
 
+bool NotCondition::Match(const RecordView &iView) const {
+  return !_pCond->Match(iView);
+}
+
+bool NotCondition::Compile(RecordFilter *pFilter) const {
+  Size nBegin = pFilter->Begin(FilterOp::NOT);
+  if (!_pCond->Compile(pFilter)) return false;
+  pFilter->End(nBegin);
+  return true;
+}
+
 }  // namespace thdb
@@ -9,6 +9,8 @@ class NotCondition : public Condition {
   NotCondition(Condition *pCond);
   ~NotCondition();
   bool Match(const Record &iRecord) const override;
+  bool Match(const RecordView &iView) const override;
+  bool Compile(RecordFilter *pFilter) const override;
 
  private:
   Condition *_pCond;
@@ -21,4 +21,22 @@ bool OrCondition::Match(const Record &iRecord) const {
   return false;
 }
 
+bool OrCondition::Match(const RecordView &iView) const {
+  for (auto it = _iCondVec.begin(); it != _iCondVec.end(); ++it) {
+    if ((*it)->Match(iView))
+      return true;
+    else
+      continue;
+  }
+  return false;
+}
+
+bool OrCondition::Compile(RecordFilter *pFilter) const {
+  Size nBegin = pFilter->Begin(FilterOp::OR);
+  for (const auto &pCond : _iCondVec)
+    if (!pCond->Compile(pFilter)) return false;
+  pFilter->End(nBegin);
+  return true;
+}
+
 }  // namespace thdb
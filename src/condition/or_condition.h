@@ -10,6 +10,8 @@ class OrCondition : public Condition {
   OrCondition(const std::vector<Condition *> &iCondVec);
   ~OrCondition();
   bool Match(const Record &iRecord) const override;
+  bool Match(const RecordView &iView) const override;
+  bool Compile(RecordFilter *pFilter) const override;
   void PushBack(Condition *pCond);
 
  private:
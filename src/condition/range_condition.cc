@@ -16,18 +16,41 @@ bool RangeCondition::Match(const Record &iRecord) const {
   if (pField->GetType() == FieldType::NONE_TYPE) return false;
   if (pField->GetType() == FieldType::INT_TYPE) {
     auto pIntField = dynamic_cast<IntField *>(pField);
-    int dData = pIntField->GetIntData();
-    int fMin = (_fMin < INT32_MIN) ? INT32_MIN : (ceil(_fMin));
-    int fMax = (_fMax > INT32_MAX) ? INT32_MAX : (ceil(_fMax));
-    return (dData >= fMin) && (dData < fMax);
+    return MatchInt(pIntField->GetIntData());
   } else if (pField->GetType() == FieldType::FLOAT_TYPE) {
     auto pFloatField = dynamic_cast<FloatField *>(pField);
-    double fData = pFloatField->GetFloatData();
-    return (fData >= _fMin) && (fData < _fMax);
+    return MatchFloat(pFloatField->GetFloatData());
   } else {
     // TODO: Throw Error Here
     assert(false);
   }
 }
 
+bool RangeCondition::Match(const RecordView &iView) const {
+  FieldType iType = iView.GetType(_nPos);
+  if (iType == FieldType::NONE_TYPE) return false;
+  if (iType == FieldType::INT_TYPE) {
+    return MatchInt(iView.GetInt(_nPos));
+  } else if (iType == FieldType::FLOAT_TYPE) {
+    return MatchFloat(iView.GetFloat(_nPos));
+  } else {
+    // TODO: Throw Error Here
+    assert(false);
+  }
+}
+
+bool RangeCondition::Compile(RecordFilter *pFilter) const {
+  return pFilter->AddRange(_nPos, _fMin, _fMax);
+}
+
+bool RangeCondition::MatchInt(int dData) const {
+  int fMin = (_fMin < INT32_MIN) ? INT32_MIN : (ceil(_fMin));
+  int fMax = (_fMax > INT32_MAX) ? INT32_MAX : (ceil(_fMax));
+  return (dData >= fMin) && (dData < fMax);
+}
+
+bool RangeCondition::MatchFloat(double fData) const {
+  return (fData >= _fMin) && (fData < _fMax);
+}
+
 }  // namespace thdb
@@ -17,8 +17,13 @@ class RangeCondition : public Condition {
   RangeCondition(FieldID nPos, const double &fMin, const double &fMax);
   ~RangeCondition() = default;
   bool Match(const Record &iRecord) const override;
+  bool Match(const RecordView &iView) const override;
+  bool Compile(RecordFilter *pFilter) const override;
 
  private:
+  bool MatchInt(int dData) const;
+  bool MatchFloat(double fData) const;
+
   uint32_t _nPos = 0xFFFF;
   double _fMin = DBL_MIN, _fMax = DBL_MAX;
 };
@@ -34,6 +34,37 @@ class PageOutOfSizeException : public OsException {
   virtual const char* what() const throw() { return "Page out of size"; }
 };
 
+class PageFileException : public OsException {
+ public:
+  PageFileException(const String& op) : _op(op) {
+    _msg = "Page file " + _op + " failed";
+  }
+  virtual const char* what() const throw() { return _msg.c_str(); }
+
+ private:
+  String _op;
+  String _msg;
+};
+
+class PageSizeException : public OsException {
+ public:
+  PageSizeException(Size nPageSize) : _nPageSize(nPageSize) {
+    _msg = "Unsupported page size " + std::to_string(_nPageSize);
+  }
+  virtual const char* what() const throw() { return _msg.c_str(); }
+
+ private:
+  Size _nPageSize;
+  String _msg;
+};
+
+class BufferFullException : public OsException {
+ public:
+  virtual const char* what() const throw() {
+    return "All buffer frames are pinned";
+  }
+};
+
 }  // namespace thdb
 
 #endif
@@ -36,6 +36,19 @@ class TableExistException : public TableException {
   String _msg;
 };
 
+class TableLayoutException : public TableException {
+ public:
+  TableLayoutException(const String& table) : _table(table) {
+    _msg = "rows of table " + _table + " do not fit the requested layout";
+  }
+
+  virtual const char* what() const throw() { return _msg.c_str(); }
+
+ private:
+  String _table;
+  String _msg;
+};
+
 }  // namespace thdb
 
 #endif
@@ -1,5 +1,9 @@
 #include "index/index.h"
 
+#include <algorithm>
+
+#include "field/compare.h"
+#include "minios/os.h"
 #include "page/node_page.h"
 
 namespace thdb {
@@ -26,9 +30,8 @@ Index::Index(FieldType iType) {
 }
 
 Index::Index(PageID nPageID) {
-  // TODO: 记录RootID即可
-  NodePage root = NodePage(nPageID);
-  _nRootID = root.GetPageID();
+  // 只记录RootID，根结点在第一次访问时才被读入
+  _nRootID = nPageID;
 }
 
 Index::~Index() {
@@ -40,6 +43,7 @@ void Index::Clear() {
   // TODO: 利用根结点的Clear函数清除全部索引占用页面
   NodePage root = NodePage(_nRootID);
   root.Clear();
+  MiniOS::GetOS()->ReleaseExtent(root.GetOwner());
 }
 
 PageID Index::GetRootID() const { return _nRootID; }
@@ -50,25 +54,50 @@ bool Index::Insert(Field *pKey, const PageSlotID &iPair) {
   // TODO: 根结点满时，需要进行分裂操作，同时更新RootID
   NodePage root = NodePage(_nRootID);
   root.Insert(pKey, iPair);
-  if (root.Full()) {
-    std::vector<Field *> newDataKeyVec;
-    std::vector<PageSlotID> newDataVec;
-    std::vector<PageID> newChildVec;
-    std::pair<Field *, PageSlotID> ascend_node =
-        root.PopHalf(newDataKeyVec, newDataVec, newChildVec);
+  if (root.Full()) SplitRoot(root);
+  return true;
+}
 
-    NodePage new_child = NodePage(root.GetKeyLen(), root.GetType(),
-                                  newDataKeyVec, newDataVec, newChildVec);
+Size Index::InsertBatch(std::vector<std::pair<Field *, PageSlotID>> iEntries) {
+  if (iEntries.empty()) return 0;
+  NodePage *pRoot = new NodePage(_nRootID);
+  FieldType iType = pRoot->GetType();
+  std::stable_sort(iEntries.begin(), iEntries.end(),
+                   [iType](const std::pair<Field *, PageSlotID> &iA,
+                           const std::pair<Field *, PageSlotID> &iB) {
+                     return Less(iA.first, iB.first, iType);
+                   });
+  for (const auto &iEntry : iEntries) {
+    pRoot->Insert(iEntry.first, iEntry.second);
+    if (pRoot->Full()) {
+      SplitRoot(*pRoot);
+      delete pRoot;
+      pRoot = new NodePage(_nRootID);
+    }
+  }
+  delete pRoot;
+  return iEntries.size();
+}
 
-    NodePage new_root = NodePage(root.GetKeyLen(), root.GetType());
+void Index::SplitRoot(NodePage &root) {
+  std::vector<Field *> newDataKeyVec;
+  std::vector<PageSlotID> newDataVec;
+  std::vector<PageID> newChildVec;
+  std::pair<Field *, PageSlotID> ascend_node =
+      root.PopHalf(newDataKeyVec, newDataVec, newChildVec);
 
-    new_root.Insert(ascend_node.first, ascend_node.second);
-    new_root.InsertChild(0, _nRootID);
-    new_root.InsertChild(1, new_child.GetPageID());
+  NodePage new_child =
+      NodePage(root.GetKeyLen(), root.GetType(), newDataKeyVec, newDataVec,
+               newChildVec, root.GetOwner());
 
-    _nRootID = new_root.GetPageID();
-  }
-  return true;
+  NodePage new_root = NodePage(root.GetKeyLen(), root.GetType(), {}, {}, {},
+                               root.GetOwner());
+
+  new_root.Insert(ascend_node.first, ascend_node.second);
+  new_root.InsertChild(0, _nRootID);
+  new_root.InsertChild(1, new_child.GetPageID());
+
+  _nRootID = new_root.GetPageID();
 }
 
 Size Index::Delete(Field *pKey) {
@@ -6,6 +6,8 @@
 
 namespace thdb {
 
+class NodePage;
+
 class Index {
  public:
   /**
@@ -29,6 +31,13 @@ class Index {
    * @return false 插入失败
    */
   bool Insert(Field *pKey, const PageSlotID &iPair);
+  /**
+   * @brief 批量插入Key Value Pair。
+   * 先按Key排序，使相邻的插入落在相同的叶结点上，并在整批插入期间保持根结点打开。
+   * @param iEntries 插入的Key Value Pair，Key的所有权不转移
+   * @return Size 插入的数量
+   */
+  Size InsertBatch(std::vector<std::pair<Field *, PageSlotID>> iEntries);
   /**
    * @brief 删除某个Key下所有的Key Value Pair
    * @param pKey 删除的Key
@@ -79,6 +88,11 @@ class Index {
   PageID GetRootID() const;
 
  private:
+  /**
+   * @brief 根结点满时分裂根结点并更新RootID
+   */
+  void SplitRoot(NodePage &root);
+
   PageID _nRootID;
 };
 
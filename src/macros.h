@@ -5,11 +5,16 @@
 
 namespace thdb {
 
-const PageOffset PAGE_SIZE = 4096;
+const Size MIN_PAGE_SIZE = 4096;
+/**
+ * @brief 页内偏移为16位且最高位用作溢出标记，页面不能超过32 KiB
+ */
+const Size MAX_PAGE_SIZE = 32768;
 const PageOffset HEADER_SIZE = 64;
-const PageOffset DATA_SIZE = PAGE_SIZE - HEADER_SIZE;
-const PageID MEM_PAGES = 1U << 18;
-const PageID DB_PAGES = 1U << 28;
+const Size FILE_HEADER_SIZE = 4096;
+const Size BITMAP_BLOCK_SIZE = 4096;
+const PageID MEM_PAGES = 1U << 16;
+const PageID DB_PAGES = 1U << 24;
 const PageID NULL_PAGE = 0xFFFFFFFF;
 const SlotID NULL_SLOT = 0xFFFF;
 const Size TABLE_CAPTION = 128;
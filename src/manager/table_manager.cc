@@ -7,6 +7,7 @@
 #include "exception/exceptions.h"
 #include "field/fields.h"
 #include "minios/os.h"
+#include "page/pax_page.h"
 #include "page/record_page.h"
 #include "record/fixed_record.h"
 
@@ -37,6 +38,13 @@ Table *TableManager::GetTable(const String &sTableName) {
 
 Table *TableManager::AddTable(const String &sTableName, const Schema &iSchema) {
   if (GetTable(sTableName) != nullptr) throw TableExistException(sTableName);
+  if (iSchema.GetLayout() == TableLayout::COLUMNAR) {
+    std::vector<Size> iSizeVec;
+    for (Size i = 0; i < iSchema.GetSize(); ++i)
+      iSizeVec.push_back(iSchema.GetColumn(i).GetSize());
+    if (PaxPage::GetCapacity(iSizeVec) == 0)
+      throw TableLayoutException(sTableName);
+  }
   TablePage *pPage = new TablePage(iSchema);
   PageID nTableID = pPage->GetPageID();
   delete pPage;
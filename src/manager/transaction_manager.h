@@ -18,6 +18,10 @@ class TransactionManager {
   void Commit(Transaction *txn);
   void Abort(Transaction *txn);
   void InsertRecord(Transaction *txn);
+  /**
+   * @brief 判断是否存在尚未提交或回滚的事务
+   */
+  bool HasActive() const { return !active_Txn_.empty(); }
 
  private:
   TxnID NewTxnID = 0;
@@ -0,0 +1,158 @@
+#include "minios/buffer_pool.h"
+
+#include <algorithm>
+
+#include "exception/exceptions.h"
+#include "macros.h"
+
+namespace thdb {
+
+BufferPool::BufferPool(PageFile *pFile, PageWriter *pWriter, Size nFrames,
+                       bool bHugePages)
+    : _pFile(pFile),
+      _pWriter(pWriter),
+      _nFrames(nFrames),
+      _nDirty(0),
+      _nClock(0) {
+  _pArena = new PageArena(_pFile->GetPageSize(), _nFrames, bHugePages);
+  _iFrames.reserve(_nFrames);
+  _pMeta = new Frame[_nFrames];
+  for (FrameID i = 0; i < _nFrames; ++i) {
+    _iFrames.push_back(RawPage(_pArena->GetFrame(i), _pFile->GetPageSize()));
+    _pMeta[i] = {NULL_PAGE, 0, false, false};
+    _iFree.push_back(_nFrames - 1 - i);
+  }
+}
+
+BufferPool::~BufferPool() {
+  delete _pArena;
+  delete[] _pMeta;
+}
+
+RawPage *BufferPool::Pin(PageID pid) {
+  auto it = _iPageTable.find(pid);
+  FrameID nFrame;
+  if (it != _iPageTable.end()) {
+    nFrame = it->second;
+  } else {
+    nFrame = Install(pid);
+    // 尚未写回的页面以写回队列中的内容为准
+    if (!_pWriter->Read(pid, _iFrames[nFrame].GetData()))
+      _pFile->Read(pid, _iFrames[nFrame].GetData());
+  }
+  _pMeta[nFrame].nPinCount += 1;
+  _pMeta[nFrame].bReferenced = true;
+  return &_iFrames[nFrame];
+}
+
+RawPage *BufferPool::PinNew(PageID pid) {
+  auto it = _iPageTable.find(pid);
+  FrameID nFrame = (it != _iPageTable.end()) ? it->second : Install(pid);
+  _iFrames[nFrame].Clear();
+  _pMeta[nFrame].nPinCount += 1;
+  _pMeta[nFrame].bReferenced = true;
+  MarkDirty(nFrame);
+  return &_iFrames[nFrame];
+}
+
+void BufferPool::Unpin(PageID pid, bool bDirty) {
+  auto it = _iPageTable.find(pid);
+  if (it == _iPageTable.end()) throw PageNotInitException(pid);
+  Frame &iFrame = _pMeta[it->second];
+  if (iFrame.nPinCount > 0) iFrame.nPinCount -= 1;
+  if (bDirty) MarkDirty(it->second);
+}
+
+bool BufferPool::IsPinned(PageID pid) const {
+  auto it = _iPageTable.find(pid);
+  return it != _iPageTable.end() && _pMeta[it->second].nPinCount > 0;
+}
+
+void BufferPool::Discard(PageID pid) {
+  auto it = _iPageTable.find(pid);
+  if (it == _iPageTable.end()) return;
+  MarkClean(it->second);
+  _pMeta[it->second] = {NULL_PAGE, 0, false, false};
+  _iFree.push_back(it->second);
+  _iPageTable.erase(it);
+}
+
+void BufferPool::FlushAll() {
+  std::vector<std::pair<PageID, FrameID>> iPages;
+  for (const auto &nFrame : _iDirty)
+    if (_pMeta[nFrame].bDirty)
+      iPages.push_back({_pMeta[nFrame].nPageID, nFrame});
+  std::sort(iPages.begin(), iPages.end());
+  for (const auto &iPair : iPages) {
+    if (!_pMeta[iPair.second].bDirty) continue;
+    _pWriter->Submit(iPair.first, _iFrames[iPair.second].GetData());
+    MarkClean(iPair.second);
+  }
+  _iDirty.clear();
+}
+
+void BufferPool::Flush(PageID pid) {
+  auto it = _iPageTable.find(pid);
+  if (it != _iPageTable.end() && _pMeta[it->second].bDirty) {
+    _pWriter->Submit(pid, _iFrames[it->second].GetData());
+    MarkClean(it->second);
+  }
+  _pWriter->Flush(pid);
+}
+
+Size BufferPool::GetDirtyCount() const { return _nDirty; }
+
+FrameID BufferPool::Victim() {
+  if (!_iFree.empty()) {
+    FrameID nFrame = _iFree.back();
+    _iFree.pop_back();
+    return nFrame;
+  }
+  // 每个页框最多被跳过两次：第一次清除引用位，第二次即可被选中
+  for (Size nStep = 0; nStep < 2 * _nFrames; ++nStep) {
+    FrameID nFrame = _nClock;
+    _nClock = (_nClock + 1) % _nFrames;
+    Frame &iFrame = _pMeta[nFrame];
+    if (iFrame.nPinCount > 0) continue;
+    if (iFrame.bReferenced) {
+      iFrame.bReferenced = false;
+      continue;
+    }
+    if (iFrame.bDirty) {
+      _pWriter->Submit(iFrame.nPageID, _iFrames[nFrame].GetData());
+      MarkClean(nFrame);
+    }
+    _iPageTable.erase(iFrame.nPageID);
+    iFrame = {NULL_PAGE, 0, false, false};
+    return nFrame;
+  }
+  throw BufferFullException();
+}
+
+FrameID BufferPool::Install(PageID pid) {
+  FrameID nFrame = Victim();
+  _pMeta[nFrame] = {pid, 0, false, false};
+  _iPageTable[pid] = nFrame;
+  return nFrame;
+}
+
+void BufferPool::MarkDirty(FrameID nFrame) {
+  if (_pMeta[nFrame].bDirty) return;
+  _pMeta[nFrame].bDirty = true;
+  ++_nDirty;
+  if (_iDirty.size() >= 2 * _nFrames) {
+    // 清除已经写回的过期项，保证脏页列表长度有界
+    _iDirty.clear();
+    for (FrameID i = 0; i < _nFrames; ++i)
+      if (_pMeta[i].bDirty && i != nFrame) _iDirty.push_back(i);
+  }
+  _iDirty.push_back(nFrame);
+}
+
+void BufferPool::MarkClean(FrameID nFrame) {
+  if (!_pMeta[nFrame].bDirty) return;
+  _pMeta[nFrame].bDirty = false;
+  --_nDirty;
+}
+
+}  // namespace thdb
@@ -0,0 +1,109 @@
+#ifndef THDB_BUFFER_POOL_H_
+#define THDB_BUFFER_POOL_H_
+
+#include <unordered_map>
+
+#include "defines.h"
+#include "minios/page_arena.h"
+#include "minios/page_file.h"
+#include "minios/page_writer.h"
+#include "minios/raw_page.h"
+
+namespace thdb {
+
+/**
+ * @brief 固定容量的页面缓冲池。
+ * 页面在首次访问时从PageFile读入页框，被固定(Pin)的页框不会被换出；
+ * 页框不足时使用Clock算法挑选未固定的页框换出，脏页框换出时交给PageWriter在后台写回。
+ * 全部页框来自一个连续的PageArena，空闲页框由空闲链表管理，分配与释放页面不再申请内存。
+ */
+class BufferPool {
+ public:
+  /**
+   * @param pFile 页面文件
+   * @param pWriter 后台写回线程池
+   * @param nFrames 页框数量
+   * @param bHugePages 页框区是否尝试使用大页
+   */
+  BufferPool(PageFile *pFile, PageWriter *pWriter, Size nFrames,
+             bool bHugePages);
+  ~BufferPool();
+
+  /**
+   * @brief 固定一个页面，页面不在缓冲池中时从文件读入
+   *
+   * @param pid 页面编号
+   * @return RawPage* 页面所在页框，在Unpin之前保持有效
+   */
+  RawPage *Pin(PageID pid);
+  /**
+   * @brief 为新分配的页面固定一个全0页框，不读取文件
+   *
+   * @param pid 页面编号
+   * @return RawPage* 页面所在页框，在Unpin之前保持有效
+   */
+  RawPage *PinNew(PageID pid);
+  /**
+   * @brief 解除一次页面固定
+   *
+   * @param pid 页面编号
+   * @param bDirty 固定期间是否修改了页面内容
+   */
+  void Unpin(PageID pid, bool bDirty);
+  /**
+   * @brief 判断页面是否在缓冲池中且处于固定状态
+   */
+  bool IsPinned(PageID pid) const;
+  /**
+   * @brief 丢弃页面在缓冲池中的页框，不写回文件
+   */
+  void Discard(PageID pid);
+  /**
+   * @brief 将所有脏页框按页面编号顺序提交后台写回，代价只与脏页数量相关。
+   * 返回时写回未必完成，需要持久化时应再调用PageWriter::Drain。
+   */
+  void FlushAll();
+  /**
+   * @brief 在前台写回单个页面的最新内容，返回时已写入文件但尚未持久化
+   */
+  void Flush(PageID pid);
+  /**
+   * @brief 获得当前脏页框数量
+   */
+  Size GetDirtyCount() const;
+
+ private:
+  struct Frame {
+    PageID nPageID;
+    Size nPinCount;
+    bool bDirty;
+    bool bReferenced;
+  };
+
+  /**
+   * @brief 获得一个可用页框，必要时换出页面
+   */
+  FrameID Victim();
+  FrameID Install(PageID pid);
+  void MarkDirty(FrameID nFrame);
+  void MarkClean(FrameID nFrame);
+
+  PageFile *_pFile;
+  PageWriter *_pWriter;
+  Size _nFrames;
+  PageArena *_pArena;
+  std::vector<RawPage> _iFrames;
+  Frame *_pMeta;
+  std::unordered_map<PageID, FrameID> _iPageTable;
+  std::vector<FrameID> _iFree;
+  /**
+   * @brief 自上次写回以来被标记为脏的页框，可能包含已经写回的重复项
+   */
+  std::vector<FrameID> _iDirty;
+  Size _nDirty;
+  FrameID _nClock;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_BUFFER_POOL_H_
@@ -0,0 +1,143 @@
+#include "minios/file_header.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "exception/exceptions.h"
+#include "macros.h"
+
+namespace thdb {
+
+const char FILE_MAGIC[8] = {'T', 'H', 'D', 'B', 'P', 'A', 'G', 'E'};
+const uint32_t FILE_VERSION = 1;
+const PageOffset VERSION_OFFSET = 8;
+const PageOffset PAGE_SIZE_OFFSET = 12;
+
+static bool ValidPageSize(Size nPageSize) {
+  return nPageSize >= MIN_PAGE_SIZE && nPageSize <= MAX_PAGE_SIZE &&
+         (nPageSize & (nPageSize - 1)) == 0;
+}
+
+static bool WriteHeader(int nFd, Size nPageSize) {
+  uint8_t *pBlock = new uint8_t[FILE_HEADER_SIZE];
+  memset(pBlock, 0, FILE_HEADER_SIZE);
+  memcpy(pBlock, FILE_MAGIC, sizeof(FILE_MAGIC));
+  memcpy(pBlock + VERSION_OFFSET, &FILE_VERSION, 4);
+  uint32_t nSize = nPageSize;
+  memcpy(pBlock + PAGE_SIZE_OFFSET, &nSize, 4);
+  bool bWritten = pwrite(nFd, pBlock, FILE_HEADER_SIZE, 0) ==
+                  (ssize_t)FILE_HEADER_SIZE;
+  delete[] pBlock;
+  return bWritten;
+}
+
+static bool ConvertPages(int nOld, Size nOldSize, int nNew,
+                         const std::vector<uint8_t> &iBits) {
+  if (!WriteHeader(nNew, MIN_PAGE_SIZE)) return false;
+  std::vector<uint8_t> iPage(MIN_PAGE_SIZE);
+  Size nPacked = 0;
+  for (Size pid = 0; pid < iBits.size() * 8; ++pid) {
+    if (!((iBits[pid / 8] >> (pid % 8)) & 1)) continue;
+    if (pread(nOld, iPage.data(), MIN_PAGE_SIZE,
+              (off_t)nPacked * MIN_PAGE_SIZE) != (ssize_t)MIN_PAGE_SIZE)
+      return false;
+    if (pwrite(nNew, iPage.data(), MIN_PAGE_SIZE,
+               FILE_HEADER_SIZE + (off_t)pid * MIN_PAGE_SIZE) !=
+        (ssize_t)MIN_PAGE_SIZE)
+      return false;
+    ++nPacked;
+  }
+  // 页面数量与位图不符时文件并非旧版本数据库，拒绝打开
+  if ((off_t)nPacked * MIN_PAGE_SIZE != (off_t)nOldSize) return false;
+  return fdatasync(nNew) == 0;
+}
+
+static void ConvertLegacy(const String &sPath, const String &sBitmapPath,
+                          Size nOldSize) {
+  std::vector<uint8_t> iBits;
+  int nBitmap = open(sBitmapPath.c_str(), O_RDONLY);
+  if (nBitmap >= 0) {
+    struct stat iStat;
+    bool bRead = fstat(nBitmap, &iStat) == 0;
+    if (bRead) {
+      iBits.resize(iStat.st_size);
+      bRead = pread(nBitmap, iBits.data(), iBits.size(), 0) ==
+              (ssize_t)iBits.size();
+    }
+    close(nBitmap);
+    if (!bRead) throw PageFileException("convert");
+  }
+  // 写入临时文件后整体替换，转换中途崩溃时原文件保持不变
+  String sTemp = sPath + ".convert";
+  int nOld = open(sPath.c_str(), O_RDONLY);
+  if (nOld < 0) throw PageFileException("convert");
+  int nNew = open(sTemp.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (nNew < 0) {
+    close(nOld);
+    throw PageFileException("convert");
+  }
+  bool bConverted = ConvertPages(nOld, nOldSize, nNew, iBits);
+  close(nOld);
+  close(nNew);
+  if (!bConverted || rename(sTemp.c_str(), sPath.c_str()) < 0) {
+    unlink(sTemp.c_str());
+    throw PageFileException("convert");
+  }
+}
+
+FileHeader::FileHeader(const String &sPath, const String &sBitmapPath,
+                       Size nPageSize) {
+  int nFd = open(sPath.c_str(), O_RDWR | O_CREAT, 0644);
+  if (nFd < 0) throw PageFileException("open");
+  struct stat iStat;
+  if (fstat(nFd, &iStat) < 0) {
+    close(nFd);
+    throw PageFileException("stat");
+  }
+  uint8_t pHeader[16];
+  memset(pHeader, 0, sizeof(pHeader));
+  if (iStat.st_size == 0) {
+    if (!ValidPageSize(nPageSize)) {
+      close(nFd);
+      throw PageSizeException(nPageSize);
+    }
+    // 新数据库：写入文件头后页面区从FILE_HEADER_SIZE开始
+    if (!WriteHeader(nFd, nPageSize) || fdatasync(nFd) < 0) {
+      close(nFd);
+      throw PageFileException("write");
+    }
+    _nPageSize = nPageSize;
+    _nBaseOffset = FILE_HEADER_SIZE;
+  } else if (pread(nFd, pHeader, sizeof(pHeader), 0) ==
+                 (ssize_t)sizeof(pHeader) &&
+             memcmp(pHeader, FILE_MAGIC, sizeof(FILE_MAGIC)) == 0) {
+    uint32_t nSize;
+    memcpy(&nSize, pHeader + PAGE_SIZE_OFFSET, 4);
+    if (!ValidPageSize(nSize)) {
+      close(nFd);
+      throw PageSizeException(nSize);
+    }
+    _nPageSize = nSize;
+    _nBaseOffset = FILE_HEADER_SIZE;
+  } else {
+    // 旧数据库文件没有文件头，且只按位图顺序紧密存放已使用的页面，
+    // 需要先转换为按页面编号定位的格式
+    close(nFd);
+    ConvertLegacy(sPath, sBitmapPath, iStat.st_size);
+    _nPageSize = MIN_PAGE_SIZE;
+    _nBaseOffset = FILE_HEADER_SIZE;
+    return;
+  }
+  close(nFd);
+}
+
+Size FileHeader::GetPageSize() const { return _nPageSize; }
+
+Size FileHeader::GetBaseOffset() const { return _nBaseOffset; }
+
+}  // namespace thdb
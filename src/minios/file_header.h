@@ -0,0 +1,38 @@
+#ifndef THDB_FILE_HEADER_H_
+#define THDB_FILE_HEADER_H_
+
+#include "defines.h"
+
+namespace thdb {
+
+/**
+ * @brief 页面文件头，记录数据库创建时确定的页面大小。
+ * 文件头占据页面文件开头的FILE_HEADER_SIZE字节，页面区紧随其后。
+ * 没有文件头的旧数据库文件按位图顺序紧密存放已使用的页面，
+ * 打开时转换为带文件头、按页面编号定位的格式，页面大小为MIN_PAGE_SIZE。
+ */
+class FileHeader {
+ public:
+  /**
+   * @brief 读取页面文件头，文件为空时以nPageSize写入新的文件头
+   *
+   * @param sPath 页面文件路径
+   * @param sBitmapPath 页面位图文件路径，转换旧版本数据库文件时使用
+   * @param nPageSize 新建数据库时使用的页面大小
+   */
+  FileHeader(const String &sPath, const String &sBitmapPath, Size nPageSize);
+
+  Size GetPageSize() const;
+  /**
+   * @brief 获得页面0在文件中的偏移
+   */
+  Size GetBaseOffset() const;
+
+ private:
+  Size _nPageSize;
+  Size _nBaseOffset;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_FILE_HEADER_H_
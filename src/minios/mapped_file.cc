@@ -0,0 +1,67 @@
+#include "minios/mapped_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "exception/exceptions.h"
+#include "macros.h"
+
+namespace thdb {
+
+MappedFile::MappedFile(const String &sPath, PageID nCapacity, Size nPageSize,
+                       Size nBaseOffset)
+    : _nCapacity(nCapacity), _nPageSize(nPageSize), _nBaseOffset(nBaseOffset) {
+  _nFd = open(sPath.c_str(), O_RDWR | O_CREAT, 0644);
+  if (_nFd < 0) throw PageFileException("open");
+  struct stat iStat;
+  if (fstat(_nFd, &iStat) < 0) throw PageFileException("stat");
+  _nFilePages = ((Size)iStat.st_size <= _nBaseOffset)
+                    ? 0
+                    : (iStat.st_size - _nBaseOffset + _nPageSize - 1) /
+                          _nPageSize;
+  void *pBase = mmap(nullptr, (size_t)_nCapacity * _nPageSize,
+                     PROT_READ | PROT_WRITE, MAP_SHARED, _nFd, _nBaseOffset);
+  if (pBase == MAP_FAILED) throw PageFileException("mmap");
+  _pBase = (uint8_t *)pBase;
+}
+
+MappedFile::~MappedFile() {
+  munmap(_pBase, (size_t)_nCapacity * _nPageSize);
+  close(_nFd);
+}
+
+uint8_t *MappedFile::GetPage(PageID pid) {
+  if (pid >= _nCapacity) throw PageOutOfSizeException();
+  if (pid >= _nFilePages) {
+    // 按倍增方式扩展文件，避免访问文件末尾之外的映射区域
+    PageID nPages = (_nFilePages < 64) ? 64 : _nFilePages * 2;
+    while (nPages <= pid) nPages *= 2;
+    if (nPages > _nCapacity) nPages = _nCapacity;
+    if (ftruncate(_nFd, _nBaseOffset + (off_t)nPages * _nPageSize) < 0)
+      throw PageFileException("truncate");
+    _nFilePages = nPages;
+  }
+  return _pBase + (size_t)pid * _nPageSize;
+}
+
+void MappedFile::Advise(PageID pid, PageID nPages) {
+  if (pid >= _nFilePages) return;
+  if (nPages > _nFilePages - pid) nPages = _nFilePages - pid;
+  madvise(_pBase + (size_t)pid * _nPageSize, (size_t)nPages * _nPageSize,
+          MADV_WILLNEED);
+}
+
+void MappedFile::Sync() {
+  if (msync(_pBase, (size_t)_nFilePages * _nPageSize, MS_SYNC) < 0)
+    throw PageFileException("sync");
+}
+
+void MappedFile::Sync(PageID pid) {
+  if (pid >= _nFilePages) return;
+  if (msync(_pBase + (size_t)pid * _nPageSize, _nPageSize, MS_SYNC) < 0)
+    throw PageFileException("sync");
+}
+
+}  // namespace thdb
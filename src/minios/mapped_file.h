@@ -0,0 +1,56 @@
+#ifndef THDB_MAPPED_FILE_H_
+#define THDB_MAPPED_FILE_H_
+
+#include "defines.h"
+
+namespace thdb {
+
+/**
+ * @brief 以内存映射方式访问的页面文件。
+ * 启动时一次性映射nCapacity个页面的地址空间，文件长度随页面分配按需增长，
+ * 页面内容的写回交由操作系统完成，检查点时使用msync同步。
+ */
+class MappedFile {
+ public:
+  /**
+   * @param sPath 文件路径
+   * @param nCapacity 映射的页面数量
+   * @param nPageSize 页面大小
+   * @param nBaseOffset 页面0在文件中的偏移，须为系统页面大小的整数倍
+   */
+  MappedFile(const String &sPath, PageID nCapacity, Size nPageSize,
+             Size nBaseOffset = 0);
+  ~MappedFile();
+
+  /**
+   * @brief 获得页面在映射区中的地址，必要时扩展文件长度
+   *
+   * @param pid 页面编号
+   * @return uint8_t* 页面地址，在MappedFile析构前保持有效
+   */
+  uint8_t *GetPage(PageID pid);
+  /**
+   * @brief 将映射区中修改过的页面同步到磁盘
+   */
+  void Sync();
+  /**
+   * @brief 只将页面pid同步到磁盘
+   */
+  void Sync(PageID pid);
+  /**
+   * @brief 提示操作系统即将访问从pid开始的nPages个页面，立即返回
+   */
+  void Advise(PageID pid, PageID nPages);
+
+ private:
+  int _nFd;
+  uint8_t *_pBase;
+  PageID _nCapacity;
+  PageID _nFilePages;
+  Size _nPageSize;
+  Size _nBaseOffset;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_MAPPED_FILE_H_
@@ -1,16 +1,20 @@
 #include "minios/os.h"
 
+#include <assert.h>
+
+#include <algorithm>
 #include <cstring>
-#include <fstream>
 
 #include "exception/exceptions.h"
 #include "macros.h"
+#include "minios/file_header.h"
 #include "minios/raw_page.h"
 #include "settings.h"
 
 namespace thdb {
 
 MiniOS *MiniOS::os = nullptr;
+Size MiniOS::nCreatePageSize = DEFAULT_PAGE_SIZE;
 
 MiniOS *MiniOS::GetOS() {
   if (os == nullptr) os = new MiniOS();
@@ -24,46 +28,124 @@ void MiniOS::WriteBack() {
   }
 }
 
+void MiniOS::SetPageSize(Size nPageSize) { nCreatePageSize = nPageSize; }
+
+std::vector<PageObserver *> &MiniOS::Observers() {
+  static std::vector<PageObserver *> iObservers;
+  return iObservers;
+}
+
+void MiniOS::Subscribe(PageObserver *pObserver) {
+  Observers().push_back(pObserver);
+}
+
+void MiniOS::Unsubscribe(PageObserver *pObserver) {
+  auto &iObservers = Observers();
+  iObservers.erase(
+      std::remove(iObservers.begin(), iObservers.end(), pObserver),
+      iObservers.end());
+}
+
 MiniOS::MiniOS() {
-  _pMemory = new RawPage *[MEM_PAGES];
-  _pUsed = new Bitmap(MEM_PAGES);
-  memset(_pMemory, 0, MEM_PAGES);
-  _nClock = 0;
+  _pFile = nullptr;
+  _pWriter = nullptr;
+  _pPool = nullptr;
+  _pMap = nullptr;
+  FileHeader iHeader("THDB_PAGE", "THDB_BITMAP", nCreatePageSize);
+  _nPageSize = iHeader.GetPageSize();
+  if (STORAGE_MODE == StorageMode::MMAP) {
+    _pMap = new MappedFile("THDB_PAGE", DB_PAGES, _nPageSize,
+                           iHeader.GetBaseOffset());
+  } else {
+    _pFile =
+        new PageFile("THDB_PAGE", _nPageSize, iHeader.GetBaseOffset());
+    _pWriter = new PageWriter(_pFile, PAGE_WRITER_THREADS,
+                              PAGE_WRITER_RATE_LIMIT, PAGE_WRITER_QUEUE_LIMIT);
+    // 缓冲池占用的内存与页面大小无关
+    _pPool = new BufferPool(_pFile, _pWriter,
+                            MEM_PAGES / (_nPageSize / MIN_PAGE_SIZE),
+                            BUFFER_POOL_HUGE_PAGES);
+  }
+  _pBitmapFile = new PageFile("THDB_BITMAP", BITMAP_BLOCK_SIZE);
+  _pUsed = new Bitmap(DB_PAGES);
+  _nLastRead = NULL_PAGE;
+  _nReadAheadEnd = 0;
+  _nHighWater = 0;
   LoadBitmap();
-  LoadPages();
 }
 
 MiniOS::~MiniOS() {
-  StoreBitmap();
-  StorePages();
-  for (size_t i = 0; i < MEM_PAGES; ++i)
-    if (_pMemory[i]) delete _pMemory[i];
-  delete[] _pMemory;
+  while (!_iExtents.empty()) ReleaseExtent(_iExtents.begin()->first);
+  Checkpoint();
+  if (_pPool) delete _pPool;
+  if (_pWriter) delete _pWriter;
+  if (_pFile) delete _pFile;
+  if (_pMap) delete _pMap;
+  delete _pBitmapFile;
   delete _pUsed;
+  for (auto pObserver : Observers()) pObserver->OnReset();
 }
 
 PageID MiniOS::NewPage() {
-  Size tmp = _nClock;
-  do {
-    if (!_pUsed->Get(_nClock)) {
-      _pMemory[_nClock] = new RawPage();
-      _pUsed->Set(_nClock);
-      return _nClock;
-    } else {
-      _nClock += 1;
-      _nClock %= MEM_PAGES;
-    }
-  } while (_nClock != tmp);
-  throw NewPageException();
+  // 位图摘要直接给出编号最小的空闲页面，分配代价与数据库填充程度无关
+  PageID nPageID = _pUsed->FirstFree();
+  if (nPageID >= DB_PAGES) throw NewPageException();
+  InitPage(nPageID);
+  SetUsed(nPageID, true);
+  return nPageID;
+}
+
+PageID MiniOS::NewPage(PageID nOwner) {
+  auto it = _iExtents.find(nOwner);
+  if (it == _iExtents.end() || it->second.first == it->second.second) {
+    // 优先预留紧接上一区段的页面，使区段之间也保持连续
+    PageID nHint = (it == _iExtents.end()) ? 0 : it->second.second;
+    PageID nBegin = _pUsed->FreeRun(EXTENT_PAGES, nHint);
+    if (nBegin >= DB_PAGES) return NewPage();
+    // 新区段需要扩展文件而文件中仍有释放留下的空洞时，逐页复用空洞
+    if (nBegin >= _nHighWater && _pUsed->FirstFree() < _nHighWater)
+      return NewPage();
+    for (PageID i = nBegin; i < nBegin + EXTENT_PAGES; ++i) SetUsed(i, true);
+    _iExtents[nOwner] = {nBegin, nBegin + EXTENT_PAGES};
+    it = _iExtents.find(nOwner);
+  }
+  PageID nPageID = it->second.first++;
+  // 预留时未写入位图文件，分配后才需要持久化
+  _iDirtyBitmap.insert(nPageID / (BITMAP_BLOCK_SIZE * 8));
+  InitPage(nPageID);
+  return nPageID;
+}
+
+void MiniOS::ReleaseExtent(PageID nOwner) {
+  auto it = _iExtents.find(nOwner);
+  if (it == _iExtents.end()) return;
+  for (PageID i = it->second.first; i < it->second.second; ++i)
+    SetUsed(i, false);
+  _iExtents.erase(it);
+}
+
+void MiniOS::Notify(PageID pid) {
+  for (auto pObserver : Observers()) pObserver->OnPageChanged(pid);
+}
+
+void MiniOS::InitPage(PageID pid) {
+  Notify(pid);
+  // 新页面可能复用已释放页面的文件位置，需要以全0页面覆盖
+  if (_pMap) {
+    memset(_pMap->GetPage(pid), 0, _nPageSize);
+  } else {
+    _pPool->PinNew(pid);
+    _pPool->Unpin(pid, true);
+  }
 }
 
 void MiniOS::DeletePage(PageID pid) {
   if (!_pUsed->Get(pid)) {
     throw PageNotInitException(pid);
   }
-  delete _pMemory[pid];
-  _pMemory[pid] = 0;
-  _pUsed->Unset(pid);
+  if (_pPool) _pPool->Discard(pid);
+  SetUsed(pid, false);
+  Notify(pid);
 }
 
 void MiniOS::ReadPage(PageID pid, uint8_t *dst, PageOffset nSize,
@@ -71,7 +153,11 @@ void MiniOS::ReadPage(PageID pid, uint8_t *dst, PageOffset nSize,
   if (!_pUsed->Get(pid)) {
     throw PageNotInitException(pid);
   }
-  _pMemory[pid]->Read(dst, nSize, nOffset);
+  if ((Size)(nSize + nOffset) > _nPageSize) {
+    throw PageOutOfSizeException();
+  }
+  memcpy(dst, Acquire(pid) + nOffset, nSize);
+  Release(pid, false);
 }
 
 void MiniOS::WritePage(PageID pid, const uint8_t *src, PageOffset nSize,
@@ -79,54 +165,149 @@ void MiniOS::WritePage(PageID pid, const uint8_t *src, PageOffset nSize,
   if (!_pUsed->Get(pid)) {
     throw PageNotInitException(pid);
   }
-  _pMemory[pid]->Write(src, nSize, nOffset);
+  if ((Size)(nSize + nOffset) > _nPageSize) {
+    throw PageOutOfSizeException();
+  }
+  memcpy(Acquire(pid) + nOffset, src, nSize);
+  Release(pid, true);
+}
+
+const uint8_t *MiniOS::View(PageID pid) {
+  if (!_pUsed->Get(pid)) {
+    throw PageNotInitException(pid);
+  }
+  assert(!_pPool || _pPool->IsPinned(pid));
+  const uint8_t *pData = Acquire(pid);
+  Release(pid, false);
+  return pData;
+}
+
+uint8_t *MiniOS::Pin(PageID pid) {
+  if (!_pUsed->Get(pid)) {
+    throw PageNotInitException(pid);
+  }
+  return Acquire(pid);
+}
+
+void MiniOS::Unpin(PageID pid, bool bDirty) {
+  if (!_pUsed->Get(pid)) return;
+  Release(pid, bDirty);
+}
+
+void MiniOS::ReadAhead(PageID pid) {
+  bool bSequential = (pid == _nLastRead + 1);
+  _nLastRead = pid;
+  if (!bSequential) _nReadAheadEnd = 0;
+  if (READ_AHEAD_PAGES == 0 || !bSequential) return;
+  // 剩余的预读窗口不足一半时再发出下一批请求，避免每页都发出系统调用
+  if (pid + READ_AHEAD_PAGES / 2 < _nReadAheadEnd) return;
+  PageID nBegin = (_nReadAheadEnd > pid) ? _nReadAheadEnd : pid;
+  PageID nEnd = pid + READ_AHEAD_PAGES;
+  if (nEnd > DB_PAGES) nEnd = DB_PAGES;
+  if (nBegin >= nEnd) return;
+  if (_pMap) {
+    _pMap->Advise(nBegin, nEnd - nBegin);
+  } else {
+    _pFile->Advise(nBegin, nEnd - nBegin);
+  }
+  _nReadAheadEnd = nEnd;
+}
+
+uint8_t *MiniOS::Acquire(PageID pid) {
+  if (_pMap) return _pMap->GetPage(pid);
+  return _pPool->Pin(pid)->GetData();
+}
+
+void MiniOS::Release(PageID pid, bool bDirty) {
+  if (bDirty) Notify(pid);
+  if (_pMap) return;
+  _pPool->Unpin(pid, bDirty);
+  // 脏页积累到一定数量后交给后台写回，前台不等待写回完成
+  if (bDirty && _pPool->GetDirtyCount() >= FLUSH_DIRTY_PAGES)
+    _pPool->FlushAll();
+}
+
+void MiniOS::Checkpoint() {
+  // 先持久化页面，再持久化引用这些页面的位图
+  if (_pMap) {
+    _pMap->Sync();
+  } else {
+    _pPool->FlushAll();
+    _pWriter->Drain();
+    _pFile->Sync();
+  }
+  if (_iDirtyBitmap.empty()) return;
+  StoreBitmap();
+  _pBitmapFile->Sync();
+}
+
+void MiniOS::SyncPages(const std::vector<PageID> &iPages) {
+  if (_pMap) {
+    for (const auto &pid : iPages) _pMap->Sync(pid);
+  } else {
+    for (const auto &pid : iPages) _pPool->Flush(pid);
+    _pFile->Sync();
+  }
+  // 页面可能是新分配的，位图需要一并持久化，崩溃后才不会被再次分配
+  if (_iDirtyBitmap.empty()) return;
+  StoreBitmap();
+  _pBitmapFile->Sync();
+}
+
+Size MiniOS::GetFlushQueueDepth() const {
+  return _pWriter ? _pWriter->GetQueueDepth() : 0;
+}
+
+void MiniOS::SetUsed(PageID pid, bool bUsed) {
+  if (bUsed) {
+    _pUsed->Set(pid);
+    if (pid >= _nHighWater) _nHighWater = pid + 1;
+  } else
+    _pUsed->Unset(pid);
+  _iDirtyBitmap.insert(pid / (BITMAP_BLOCK_SIZE * 8));
 }
 
 void MiniOS::LoadBitmap() {
-  std::ifstream fin("THDB_BITMAP", std::ios::binary);
-  if (!fin) return;
-  uint8_t pTemp[MEM_PAGES / 8];
-  fin.read((char *)pTemp, MEM_PAGES / 8);
-  fin.close();
-  _pUsed->Load(pTemp);
-}
-
-void MiniOS::LoadPages() {
-  std::ifstream fin("THDB_PAGE", std::ios::binary);
-  if (!fin) return;
-  uint8_t pTemp[PAGE_SIZE];
-  for (uint32_t i = 0; i < MEM_PAGES; ++i) {
-    if (_pUsed->Get(i)) {
-      fin.read((char *)pTemp, PAGE_SIZE);
-      _pMemory[i] = new RawPage();
-      _pMemory[i]->Write(pTemp, PAGE_SIZE);
-    }
+  // 只读取位图文件中实际存在的块，启动代价与数据量无关
+  PageID nBlocks = _pBitmapFile->GetPageCount();
+  if (nBlocks > DB_PAGES / 8 / BITMAP_BLOCK_SIZE)
+    nBlocks = DB_PAGES / 8 / BITMAP_BLOCK_SIZE;
+  if (nBlocks == 0) return;
+  uint8_t *pTemp = new uint8_t[nBlocks * BITMAP_BLOCK_SIZE];
+  for (PageID i = 0; i < nBlocks; ++i)
+    _pBitmapFile->Read(i, pTemp + i * BITMAP_BLOCK_SIZE);
+  _pUsed->Load(pTemp, nBlocks * BITMAP_BLOCK_SIZE);
+  // 编号最大的已使用页面之后即为文件的高水位
+  for (Size i = nBlocks * BITMAP_BLOCK_SIZE; i-- > 0;) {
+    if (pTemp[i] == 0) continue;
+    _nHighWater = i * 8 + 32 - __builtin_clz(pTemp[i]);
+    break;
   }
-  fin.close();
+  delete[] pTemp;
 }
 
 void MiniOS::StoreBitmap() {
-  std::ofstream fout("THDB_BITMAP", std::ios::binary);
-  if (!fout) return;
-  uint8_t pTemp[MEM_PAGES / 8];
-  _pUsed->Store(pTemp);
-  fout.write((char *)pTemp, MEM_PAGES / 8);
-  fout.close();
-}
-
-void MiniOS::StorePages() {
-  std::ofstream fout("THDB_PAGE", std::ios::binary);
-  if (!fout) return;
-  uint8_t pTemp[PAGE_SIZE];
-  for (uint32_t i = 0; i < MEM_PAGES; ++i) {
-    if (_pUsed->Get(i)) {
-      _pMemory[i]->Read(pTemp, PAGE_SIZE);
-      fout.write((char *)pTemp, PAGE_SIZE);
+  uint8_t pTemp[BITMAP_BLOCK_SIZE];
+  const PageID nBlockPages = BITMAP_BLOCK_SIZE * 8;
+  for (const auto &nBlock : _iDirtyBitmap) {
+    _pUsed->Store(pTemp, nBlock * BITMAP_BLOCK_SIZE, BITMAP_BLOCK_SIZE);
+    // 预留而未分配的页面只在内存中标记，崩溃后重新打开时自然成为空闲页面
+    PageID nFirst = nBlock * nBlockPages;
+    for (const auto &iExtent : _iExtents) {
+      PageID nBegin = std::max(iExtent.second.first, nFirst);
+      PageID nEnd = std::min(iExtent.second.second, nFirst + nBlockPages);
+      for (PageID i = nBegin; i < nEnd; ++i)
+        pTemp[(i - nFirst) / 8] &= ~(1 << ((i - nFirst) % 8));
     }
+    _pBitmapFile->Write(nBlock, pTemp);
   }
-  fout.close();
+  _iDirtyBitmap.clear();
 }
 
+Size MiniOS::GetPageSize() const { return _nPageSize; }
+
+PageOffset MiniOS::GetDataSize() const { return _nPageSize - HEADER_SIZE; }
+
 Size MiniOS::GetUsedSize() const {
   if (!_pUsed) throw OsException();
   return _pUsed->GetSize();
@@ -1,7 +1,14 @@
 #ifndef THDB_OS_H_
 #define THDB_OS_H_
 
+#include <map>
+#include <set>
+
 #include "defines.h"
+#include "minios/buffer_pool.h"
+#include "minios/mapped_file.h"
+#include "minios/page_file.h"
+#include "minios/page_writer.h"
 #include "minios/raw_page.h"
 #include "utils/bitmap.h"
 
@@ -10,34 +17,154 @@ namespace thdb {
 class Page;
 class Bitmap;
 
+/**
+ * @brief 页面内容变化的观察者，用于维护页面解码结果等派生数据。
+ */
+class PageObserver {
+ public:
+  virtual ~PageObserver() {}
+  /**
+   * @brief 页面被修改、重新分配或释放后调用
+   */
+  virtual void OnPageChanged(PageID pid) = 0;
+  /**
+   * @brief MiniOS关闭时调用，此后所有页面内容都可能变化
+   */
+  virtual void OnReset() = 0;
+};
+
 class MiniOS {
  public:
   static MiniOS *GetOS();
   static void WriteBack();
+  /**
+   * @brief 注册或注销页面观察者，注册关系在MiniOS重新创建后依然有效
+   */
+  static void Subscribe(PageObserver *pObserver);
+  static void Unsubscribe(PageObserver *pObserver);
+  /**
+   * @brief 设置新建数据库使用的页面大小，须在数据库文件创建前调用。
+   * 打开已有数据库时页面大小以文件头中的记录为准。
+   */
+  static void SetPageSize(Size nPageSize);
 
   PageID NewPage();
+  /**
+   * @brief 在nOwner的区段中分配一个页面。
+   * 每个所有者预留EXTENT_PAGES个连续页面并依次分配，使同一表或索引的页面在文件中连续。
+   * 新区段需要扩展文件而高水位以下仍有空闲页面时，改为逐页复用这些页面。
+   *
+   * @param nOwner 所有者标识，通常为表页面或索引根结点的页面编号
+   * @return PageID 新页面编号
+   */
+  PageID NewPage(PageID nOwner);
+  /**
+   * @brief 归还nOwner预留但尚未分配的页面
+   */
+  void ReleaseExtent(PageID nOwner);
   void DeletePage(PageID pid);
   void ReadPage(PageID pid, uint8_t *dst, PageOffset nSize,
                 PageOffset nOffset = 0);
   void WritePage(PageID pid, const uint8_t *src, PageOffset nSize,
                  PageOffset nOffset = 0);
   Size GetUsedSize() const;
+  /**
+   * @brief 获得当前数据库的页面大小
+   */
+  Size GetPageSize() const;
+  /**
+   * @brief 获得当前数据库页面数据部分的长度
+   */
+  PageOffset GetDataSize() const;
+
+  /**
+   * @brief 获得页面内容的只读视图，不经过中间缓冲区。
+   * 缓冲池模式下调用者须已通过Pin或页面守卫固定页面，视图在解除固定前有效。
+   *
+   * @param pid 页面编号
+   * @return const uint8_t* 完整页面内容的起始地址
+   */
+  const uint8_t *View(PageID pid);
+  /**
+   * @brief 固定页面并获得可修改的页面内容地址，在Unpin之前保持有效
+   *
+   * @param pid 页面编号
+   * @return uint8_t* 完整页面内容的起始地址
+   */
+  uint8_t *Pin(PageID pid);
+  /**
+   * @brief 解除Pin对页面的固定，页面已被释放时固定随页框一并失效，不做处理
+   *
+   * @param pid 页面编号
+   * @param bDirty 固定期间是否修改了页面内容
+   */
+  void Unpin(PageID pid, bool bDirty);
+  /**
+   * @brief 通知MiniOS扫描即将访问页面pid。
+   * 检测到按页面编号顺序访问时，提前请求之后READ_AHEAD_PAGES个页面，
+   * 使链表扫描在区段内变为顺序读。
+   */
+  void ReadAhead(PageID pid);
+
+  /**
+   * @brief 检查点：将修改过的页面和位图原地写回并持久化。
+   * 只写出自上次检查点以来被修改的页面，代价与写入量而非数据库大小相关。
+   */
+  void Checkpoint();
+  /**
+   * @brief 只将iPages中的页面写回并持久化，同时持久化修改过的位图块。
+   * 其余脏页面仍由后台写回，代价与iPages的大小而非缓冲池中的脏页数量相关。
+   */
+  void SyncPages(const std::vector<PageID> &iPages);
+  /**
+   * @brief 获得后台写回队列中尚未写回的页面数量
+   */
+  Size GetFlushQueueDepth() const;
 
  private:
   MiniOS();
   ~MiniOS();
 
   void LoadBitmap();
-  void LoadPages();
-
   void StoreBitmap();
-  void StorePages();
+  void SetUsed(PageID pid, bool bUsed);
+  void InitPage(PageID pid);
+  void Notify(PageID pid);
+  static std::vector<PageObserver *> &Observers();
+  uint8_t *Acquire(PageID pid);
+  void Release(PageID pid, bool bDirty);
 
-  RawPage **_pMemory;
+  PageFile *_pFile;
+  PageFile *_pBitmapFile;
+  /**
+   * @brief 缓冲池模式下使用_pFile、_pWriter和_pPool，内存映射模式下使用_pMap
+   */
+  PageWriter *_pWriter;
+  BufferPool *_pPool;
+  MappedFile *_pMap;
   Bitmap *_pUsed;
-  Size _nClock;
+  /**
+   * @brief 自上次检查点以来被修改的位图块，每块对应位图文件中的一个页面
+   */
+  std::set<PageID> _iDirtyBitmap;
+  /**
+   * @brief 各所有者当前区段中下一个可分配页面与区段终点。
+   * 预留页面只在内存位图中标记为已使用，写回位图文件时清除，关闭时归还。
+   */
+  std::map<PageID, std::pair<PageID, PageID>> _iExtents;
+  /**
+   * @brief 编号最大的已使用页面之后的位置，页面文件不会超出这一位置
+   */
+  PageID _nHighWater;
+  /**
+   * @brief 上一次扫描访问的页面与已经预读到的位置
+   */
+  PageID _nLastRead;
+  PageID _nReadAheadEnd;
+  Size _nPageSize;
 
   static MiniOS *os;
+  static Size nCreatePageSize;
 };
 
 }  // namespace thdb
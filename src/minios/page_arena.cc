@@ -0,0 +1,50 @@
+#include "minios/page_arena.h"
+
+#include <sys/mman.h>
+
+#include "exception/exceptions.h"
+
+namespace thdb {
+
+const size_t ARENA_ALIGNMENT = 64;
+const size_t HUGE_PAGE_BYTES = 2UL << 20;
+
+PageArena::PageArena(Size nFrameSize, Size nFrames, bool bHugePages)
+    : _nFrameSize(nFrameSize), _nFrames(nFrames), _bHugeTLB(false) {
+  if (nFrameSize % ARENA_ALIGNMENT != 0) throw PageSizeException(nFrameSize);
+  _nBytes = (size_t)nFrameSize * nFrames;
+  void *pBase = MAP_FAILED;
+#ifdef MAP_HUGETLB
+  if (bHugePages) {
+    // MAP_HUGETLB要求长度为大页的整数倍，且系统须预留足够的大页
+    size_t nHugeBytes =
+        (_nBytes + HUGE_PAGE_BYTES - 1) / HUGE_PAGE_BYTES * HUGE_PAGE_BYTES;
+    pBase = mmap(nullptr, nHugeBytes, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (pBase != MAP_FAILED) {
+      _nBytes = nHugeBytes;
+      _bHugeTLB = true;
+    }
+  }
+#endif
+  if (pBase == MAP_FAILED) {
+    pBase = mmap(nullptr, _nBytes, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (pBase == MAP_FAILED) throw PageFileException("mmap");
+#ifdef MADV_HUGEPAGE
+    // 透明大页只是建议，内核不支持时忽略
+    if (bHugePages) madvise(pBase, _nBytes, MADV_HUGEPAGE);
+#endif
+  }
+  _pBase = (uint8_t *)pBase;
+}
+
+PageArena::~PageArena() { munmap(_pBase, _nBytes); }
+
+uint8_t *PageArena::GetFrame(FrameID nFrame) const {
+  return _pBase + (size_t)nFrame * _nFrameSize;
+}
+
+bool PageArena::IsHugeTLB() const { return _bHugeTLB; }
+
+}  // namespace thdb
@@ -0,0 +1,43 @@
+#ifndef THDB_PAGE_ARENA_H_
+#define THDB_PAGE_ARENA_H_
+
+#include "defines.h"
+
+namespace thdb {
+
+/**
+ * @brief 缓冲池页框所在的连续内存区。
+ * 所有页框在一次匿名映射中按页面大小依次排列，起始地址按64字节对齐，
+ * 物理内存在页框首次使用时才由操作系统分配。
+ * 可选使用大页：优先尝试MAP_HUGETLB，失败时退回普通页面并建议使用透明大页。
+ */
+class PageArena {
+ public:
+  /**
+   * @param nFrameSize 页框大小，须为64的整数倍
+   * @param nFrames 页框数量
+   * @param bHugePages 是否尝试使用大页
+   */
+  PageArena(Size nFrameSize, Size nFrames, bool bHugePages);
+  ~PageArena();
+
+  /**
+   * @brief 获得页框的起始地址
+   */
+  uint8_t *GetFrame(FrameID nFrame) const;
+  /**
+   * @brief 判断内存区是否由MAP_HUGETLB大页提供
+   */
+  bool IsHugeTLB() const;
+
+ private:
+  uint8_t *_pBase;
+  size_t _nBytes;
+  Size _nFrameSize;
+  Size _nFrames;
+  bool _bHugeTLB;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_PAGE_ARENA_H_
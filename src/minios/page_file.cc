@@ -0,0 +1,65 @@
+#include "minios/page_file.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+
+#include "exception/exceptions.h"
+#include "macros.h"
+
+namespace thdb {
+
+PageFile::PageFile(const String &sPath, Size nPageSize, Size nBaseOffset)
+    : _nPageSize(nPageSize), _nBaseOffset(nBaseOffset) {
+  _nFd = open(sPath.c_str(), O_RDWR | O_CREAT, 0644);
+  if (_nFd < 0) throw PageFileException("open");
+}
+
+PageFile::~PageFile() { close(_nFd); }
+
+void PageFile::Read(PageID pid, uint8_t *dst) {
+  off_t nOffset = _nBaseOffset + (off_t)pid * _nPageSize;
+  size_t nDone = 0;
+  while (nDone < _nPageSize) {
+    ssize_t nRead =
+        pread(_nFd, dst + nDone, _nPageSize - nDone, nOffset + nDone);
+    if (nRead < 0) throw PageFileException("read");
+    if (nRead == 0) break;
+    nDone += nRead;
+  }
+  if (nDone < _nPageSize) memset(dst + nDone, 0, _nPageSize - nDone);
+}
+
+void PageFile::Write(PageID pid, const uint8_t *src) {
+  off_t nOffset = _nBaseOffset + (off_t)pid * _nPageSize;
+  size_t nDone = 0;
+  while (nDone < _nPageSize) {
+    ssize_t nWrite =
+        pwrite(_nFd, src + nDone, _nPageSize - nDone, nOffset + nDone);
+    if (nWrite < 0) throw PageFileException("write");
+    nDone += nWrite;
+  }
+}
+
+void PageFile::Advise(PageID pid, PageID nPages) {
+  // 预读只是提示，失败时不影响正确性
+  posix_fadvise(_nFd, _nBaseOffset + (off_t)pid * _nPageSize,
+                (off_t)nPages * _nPageSize, POSIX_FADV_WILLNEED);
+}
+
+void PageFile::Sync() {
+  if (fdatasync(_nFd) < 0) throw PageFileException("sync");
+}
+
+PageID PageFile::GetPageCount() const {
+  struct stat iStat;
+  if (fstat(_nFd, &iStat) < 0) throw PageFileException("stat");
+  if ((Size)iStat.st_size <= _nBaseOffset) return 0;
+  return (iStat.st_size - _nBaseOffset + _nPageSize - 1) / _nPageSize;
+}
+
+Size PageFile::GetPageSize() const { return _nPageSize; }
+
+}  // namespace thdb
@@ -0,0 +1,59 @@
+#ifndef THDB_PAGE_FILE_H_
+#define THDB_PAGE_FILE_H_
+
+#include "defines.h"
+
+namespace thdb {
+
+/**
+ * @brief 按页面编号寻址的数据库文件。
+ * 页面pid固定存放在文件偏移nBaseOffset + pid * nPageSize处，
+ * 文件中未写入过的区域按全0页面处理。
+ */
+class PageFile {
+ public:
+  /**
+   * @param sPath 文件路径
+   * @param nPageSize 页面大小
+   * @param nBaseOffset 页面0在文件中的偏移，用于跳过文件头
+   */
+  PageFile(const String &sPath, Size nPageSize, Size nBaseOffset = 0);
+  ~PageFile();
+
+  /**
+   * @brief 读出一个完整页面
+   *
+   * @param pid 页面编号
+   * @param dst 读出内容存放地址，长度为页面大小
+   */
+  void Read(PageID pid, uint8_t *dst);
+  /**
+   * @brief 原地写入一个完整页面
+   *
+   * @param pid 页面编号
+   * @param src 写入内容存放地址，长度为页面大小
+   */
+  void Write(PageID pid, const uint8_t *src);
+  /**
+   * @brief 将已写入的内容持久化到磁盘
+   */
+  void Sync();
+  /**
+   * @brief 提示操作系统即将读取从pid开始的nPages个页面，立即返回
+   */
+  void Advise(PageID pid, PageID nPages);
+  /**
+   * @brief 获得文件当前覆盖的页面数量，末尾不完整的页面也计算在内
+   */
+  PageID GetPageCount() const;
+  Size GetPageSize() const;
+
+ private:
+  int _nFd;
+  Size _nPageSize;
+  Size _nBaseOffset;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_PAGE_FILE_H_
@@ -0,0 +1,147 @@
+#include "minios/page_writer.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "exception/exceptions.h"
+#include "macros.h"
+#include "settings.h"
+
+namespace thdb {
+
+PageWriter::PageWriter(PageFile *pFile, Size nThreads, Size nRateLimit,
+                       Size nQueueLimit)
+    : _pFile(pFile),
+      _nQueueLimit(nQueueLimit),
+      _iInterval(nRateLimit ? std::chrono::nanoseconds(1000000000 / nRateLimit)
+                            : std::chrono::nanoseconds(0)),
+      _iNext(std::chrono::steady_clock::now()),
+      _bStop(false),
+      _bFailed(false) {
+  for (Size i = 0; i < nThreads; ++i)
+    _iThreads.push_back(std::thread(&PageWriter::Run, this));
+}
+
+PageWriter::~PageWriter() {
+  {
+    std::unique_lock<std::mutex> iLock(_iMutex);
+    _iDone.wait(iLock, [this] { return _iPending.empty() || _bFailed; });
+    _bStop = true;
+  }
+  _iWork.notify_all();
+  for (auto &iThread : _iThreads) iThread.join();
+}
+
+void PageWriter::Submit(PageID pid, const uint8_t *src) {
+  Buffer pBuffer = std::make_shared<std::vector<uint8_t>>(
+      src, src + _pFile->GetPageSize());
+  std::unique_lock<std::mutex> iLock(_iMutex);
+  if (_bFailed) throw PageFileException("write");
+  // 队列积压过多时前台等待，保证写回占用的内存有界
+  _iDone.wait(iLock, [this, pid] {
+    return _iPending.size() < _nQueueLimit || _iPending.count(pid) || _bFailed;
+  });
+  _iPending[pid] = pBuffer;
+  if (_iQueued.insert(pid).second) {
+    _iQueue.push_back(pid);
+    _iWork.notify_one();
+  }
+}
+
+bool PageWriter::Read(PageID pid, uint8_t *dst) {
+  std::lock_guard<std::mutex> iLock(_iMutex);
+  auto it = _iPending.find(pid);
+  if (it == _iPending.end()) return false;
+  memcpy(dst, it->second->data(), it->second->size());
+  return true;
+}
+
+void PageWriter::Drain() {
+  std::unique_lock<std::mutex> iLock(_iMutex);
+  _iDone.wait(iLock, [this] { return _iPending.empty() || _bFailed; });
+  if (_bFailed) throw PageFileException("write");
+}
+
+void PageWriter::Flush(PageID pid) {
+  std::unique_lock<std::mutex> iLock(_iMutex);
+  // 等待其他线程写完旧内容，避免旧内容覆盖本次写回的内容
+  _iDone.wait(iLock, [this, pid] { return !_iWriting.count(pid) || _bFailed; });
+  if (_bFailed) throw PageFileException("write");
+  auto it = _iPending.find(pid);
+  if (it == _iPending.end()) return;
+  Buffer pBuffer = it->second;
+  if (_iQueued.erase(pid))
+    _iQueue.erase(std::find(_iQueue.begin(), _iQueue.end(), pid));
+  _iWriting.insert(pid);
+  iLock.unlock();
+  bool bFailed = false;
+  try {
+    _pFile->Write(pid, pBuffer->data());
+  } catch (const PageFileException &e) {
+    bFailed = true;
+  }
+  iLock.lock();
+  _iWriting.erase(pid);
+  if (bFailed) _bFailed = true;
+  it = _iPending.find(pid);
+  if (it != _iPending.end() && it->second == pBuffer) _iPending.erase(it);
+  _iDone.notify_all();
+  if (bFailed) throw PageFileException("write");
+}
+
+Size PageWriter::GetQueueDepth() const {
+  std::lock_guard<std::mutex> iLock(_iMutex);
+  return _iPending.size();
+}
+
+void PageWriter::Throttle(std::unique_lock<std::mutex> &iLock) {
+  if (_iInterval.count() == 0) return;
+  auto iNow = std::chrono::steady_clock::now();
+  auto iSlot = (_iNext > iNow) ? _iNext : iNow;
+  _iNext = iSlot + _iInterval;
+  if (iSlot <= iNow) return;
+  iLock.unlock();
+  std::this_thread::sleep_until(iSlot);
+  iLock.lock();
+}
+
+void PageWriter::Run() {
+  std::unique_lock<std::mutex> iLock(_iMutex);
+  while (true) {
+    _iWork.wait(iLock, [this] { return _bStop || !_iQueue.empty(); });
+    if (_bStop) return;
+    // 其他线程正在写回旧内容的页面留在队列中，稍后再写回新内容
+    auto itReady =
+        std::find_if(_iQueue.begin(), _iQueue.end(),
+                     [this](PageID pid) { return !_iWriting.count(pid); });
+    if (itReady == _iQueue.end()) {
+      // 旧内容写回完成时会唤醒等待的线程，超时只作为兜底
+      _iWork.wait_for(iLock,
+                      std::chrono::milliseconds(PAGE_WRITER_RETRY_MS));
+      continue;
+    }
+    PageID pid = *itReady;
+    _iQueue.erase(itReady);
+    _iQueued.erase(pid);
+    _iWriting.insert(pid);
+    Buffer pBuffer = _iPending[pid];
+    Throttle(iLock);
+    iLock.unlock();
+    bool bFailed = false;
+    try {
+      _pFile->Write(pid, pBuffer->data());
+    } catch (const PageFileException &e) {
+      bFailed = true;
+    }
+    iLock.lock();
+    _iWriting.erase(pid);
+    if (bFailed) _bFailed = true;
+    // 写回期间页面可能被再次提交，此时保留新内容等待下一次写回
+    auto it = _iPending.find(pid);
+    if (it != _iPending.end() && it->second == pBuffer) _iPending.erase(it);
+    if (_iQueued.count(pid)) _iWork.notify_one();
+    _iDone.notify_all();
+  }
+}
+
+}  // namespace thdb
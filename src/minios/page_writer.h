@@ -0,0 +1,96 @@
+#ifndef THDB_PAGE_WRITER_H_
+#define THDB_PAGE_WRITER_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "defines.h"
+#include "minios/page_file.h"
+
+namespace thdb {
+
+/**
+ * @brief 后台页面写回器。
+ * 前台提交页面内容的副本后立即返回，由后台线程池使用pwrite原地写回PageFile。
+ * 尚未写回的页面在读入时直接从写回队列中取得，保证读到最新内容。
+ */
+class PageWriter {
+ public:
+  /**
+   * @param pFile 写回的目标文件
+   * @param nThreads 后台写回线程数量
+   * @param nRateLimit 每秒最多写回的页面数量，为0时不限速
+   * @param nQueueLimit 队列中最多积压的页面数量，超过时提交操作等待
+   */
+  PageWriter(PageFile *pFile, Size nThreads, Size nRateLimit,
+             Size nQueueLimit);
+  ~PageWriter();
+
+  /**
+   * @brief 提交一个页面的写回，同一页面尚未写回的旧内容会被覆盖
+   *
+   * @param pid 页面编号
+   * @param src 页面内容，长度为页面大小，调用返回后即可修改
+   */
+  void Submit(PageID pid, const uint8_t *src);
+  /**
+   * @brief 若页面仍在写回队列中，读出其最新内容
+   *
+   * @return true 页面在队列中，内容已写入dst
+   * @return false 页面不在队列中
+   */
+  bool Read(PageID pid, uint8_t *dst);
+  /**
+   * @brief 等待队列中的所有页面写回完成
+   */
+  void Drain();
+  /**
+   * @brief 在前台立即写回页面pid尚未写回的内容，不等待队列中的其他页面
+   */
+  void Flush(PageID pid);
+  /**
+   * @brief 获得尚未写回完成的页面数量
+   */
+  Size GetQueueDepth() const;
+
+ private:
+  typedef std::shared_ptr<std::vector<uint8_t>> Buffer;
+
+  void Run();
+  /**
+   * @brief 按限速要求等待下一次写回的时机
+   */
+  void Throttle(std::unique_lock<std::mutex> &iLock);
+
+  PageFile *_pFile;
+  Size _nQueueLimit;
+  std::chrono::nanoseconds _iInterval;
+  std::chrono::steady_clock::time_point _iNext;
+
+  mutable std::mutex _iMutex;
+  std::condition_variable _iWork;
+  std::condition_variable _iDone;
+  /**
+   * @brief 每个待写回页面的最新内容
+   */
+  std::unordered_map<PageID, Buffer> _iPending;
+  std::deque<PageID> _iQueue;
+  std::unordered_set<PageID> _iQueued;
+  /**
+   * @brief 正在被某个线程写回的页面，同一页面不会被并发写回
+   */
+  std::unordered_set<PageID> _iWriting;
+  std::vector<std::thread> _iThreads;
+  bool _bStop;
+  bool _bFailed;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_PAGE_WRITER_H_
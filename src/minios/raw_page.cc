@@ -7,25 +7,24 @@
 
 namespace thdb {
 
-RawPage::RawPage() {
-  _pData = new uint8_t[PAGE_SIZE];
-  memset(_pData, 0, PAGE_SIZE);
-}
-
-RawPage::~RawPage() { delete[] _pData; }
+RawPage::RawPage(uint8_t* pData, Size nSize) : _pData(pData), _nSize(nSize) {}
 
 void RawPage::Read(uint8_t* dst, PageOffset nSize, PageOffset nOffset) {
-  if ((nSize + nOffset) > PAGE_SIZE) {
+  if ((nSize + nOffset) > _nSize) {
     throw PageOutOfSizeException();
   }
   memcpy(dst, _pData + nOffset, nSize);
 }
 
 void RawPage::Write(const uint8_t* src, PageOffset nSize, PageOffset nOffset) {
-  if ((nSize + nOffset) > PAGE_SIZE) {
+  if ((nSize + nOffset) > _nSize) {
     throw PageOutOfSizeException();
   }
   memcpy(_pData + nOffset, src, nSize);
 }
 
+void RawPage::Clear() { memset(_pData, 0, _nSize); }
+
+uint8_t* RawPage::GetData() { return _pData; }
+
 }  // namespace thdb
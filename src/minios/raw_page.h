@@ -5,16 +5,29 @@
 
 namespace thdb {
 
+/**
+ * @brief 页框，指向PageArena中的一段内存，不拥有该内存。
+ */
 class RawPage {
  public:
-  RawPage();
-  ~RawPage();
+  /**
+   * @param pData 页框内存地址
+   * @param nSize 页面大小
+   */
+  RawPage(uint8_t* pData, Size nSize);
 
   void Read(uint8_t* dst, PageOffset nSize, PageOffset nOffset = 0);
   void Write(const uint8_t* src, PageOffset nSize, PageOffset nOffset = 0);
+  void Clear();
+
+  /**
+   * @brief 获得页框内完整页面内容的地址，用于与页面文件之间的整页读写
+   */
+  uint8_t* GetData();
 
  private:
   uint8_t* _pData;
+  Size _nSize;
 };
 
 }  // namespace thdb
@@ -0,0 +1,72 @@
+#ifndef THDB_DECODED_CACHE_H_
+#define THDB_DECODED_CACHE_H_
+
+#include <list>
+#include <memory>
+#include <unordered_map>
+
+#include "defines.h"
+#include "minios/os.h"
+
+namespace thdb {
+
+/**
+ * @brief 以PageID为键、容量有界的页面解码结果缓存。
+ * 页面被写入、重新分配或释放时对应项自动失效，容量不足时按LRU淘汰。
+ * 缓存项以shared_ptr交出，失效或淘汰后仍被持有的解码结果保持有效。
+ *
+ * @tparam T 解码结果类型
+ */
+template <class T>
+class DecodedCache : public PageObserver {
+ public:
+  explicit DecodedCache(Size nCapacity) : _nCapacity(nCapacity) {
+    MiniOS::Subscribe(this);
+  }
+  ~DecodedCache() { MiniOS::Unsubscribe(this); }
+
+  /**
+   * @brief 查找页面的解码结果，未命中时返回空指针
+   */
+  std::shared_ptr<const T> Get(PageID pid) {
+    auto it = _iEntries.find(pid);
+    if (it == _iEntries.end()) return nullptr;
+    _iLRU.splice(_iLRU.begin(), _iLRU, it->second.second);
+    return it->second.first;
+  }
+
+  void Put(PageID pid, const std::shared_ptr<const T> &pValue) {
+    if (_nCapacity == 0) return;
+    OnPageChanged(pid);
+    if (_iEntries.size() >= _nCapacity) {
+      _iEntries.erase(_iLRU.back());
+      _iLRU.pop_back();
+    }
+    _iLRU.push_front(pid);
+    _iEntries[pid] = {pValue, _iLRU.begin()};
+  }
+
+  void OnPageChanged(PageID pid) override {
+    auto it = _iEntries.find(pid);
+    if (it == _iEntries.end()) return;
+    _iLRU.erase(it->second.second);
+    _iEntries.erase(it);
+  }
+
+  void OnReset() override {
+    _iEntries.clear();
+    _iLRU.clear();
+  }
+
+ private:
+  typedef std::list<PageID>::iterator Position;
+
+  Size _nCapacity;
+  std::list<PageID> _iLRU;
+  std::unordered_map<PageID, std::pair<std::shared_ptr<const T>, Position>>
+      _iEntries;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_DECODED_CACHE_H_
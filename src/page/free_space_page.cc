@@ -0,0 +1,72 @@
+#include "page/free_space_page.h"
+
+#include <cstring>
+
+#include "exception/exceptions.h"
+#include "macros.h"
+#include "minios/os.h"
+#include "page/page_guard.h"
+
+namespace thdb {
+
+const PageOffset USED_ENTRIES_OFFSET = 12;
+
+FreeSpacePage::FreeSpacePage(PageID nOwner, NewPageTag)
+    : LinkedPage(nOwner, NEW_PAGE) {
+  _bDirty = true;
+}
+
+FreeSpacePage::FreeSpacePage(PageID nPageID) : LinkedPage(nPageID) {
+  _bDirty = false;
+  ReadPageGuard iGuard(nPageID);
+  SlotID nUsed = iGuard.GetHeader<SlotID>(USED_ENTRIES_OFFSET);
+  _iHeapVec.resize(nUsed);
+  _iBucketVec.resize(nUsed);
+  memcpy(_iHeapVec.data(), iGuard.GetDataView(), sizeof(PageID) * nUsed);
+  memcpy(_iBucketVec.data(), iGuard.GetDataView() + sizeof(PageID) * GetCap(),
+         nUsed);
+}
+
+FreeSpacePage::~FreeSpacePage() {
+  if (!_bDirty) return;
+  WritePageGuard iGuard(_nPageID);
+  SlotID nUsed = _iHeapVec.size();
+  iGuard.SetHeader(USED_ENTRIES_OFFSET, nUsed);
+  uint8_t *pData = iGuard.GetMutableData();
+  memcpy(pData, _iHeapVec.data(), sizeof(PageID) * nUsed);
+  memcpy(pData + sizeof(PageID) * GetCap(), _iBucketVec.data(), nUsed);
+}
+
+Size FreeSpacePage::GetCap() {
+  return MiniOS::GetOS()->GetDataSize() / (sizeof(PageID) + 1);
+}
+
+SlotID FreeSpacePage::Append(PageID nHeapID, uint8_t nBucket) {
+  if (Full()) throw ToastPageFullException();
+  _bDirty = true;
+  _iHeapVec.push_back(nHeapID);
+  _iBucketVec.push_back(nBucket);
+  return _iHeapVec.size() - 1;
+}
+
+void FreeSpacePage::SetBucket(SlotID nSlotID, uint8_t nBucket) {
+  if (nSlotID >= _iBucketVec.size()) throw RecordPageException(nSlotID);
+  _bDirty = true;
+  _iBucketVec[nSlotID] = nBucket;
+}
+
+PageID FreeSpacePage::GetHeapID(SlotID nSlotID) const {
+  if (nSlotID >= _iHeapVec.size()) throw RecordPageException(nSlotID);
+  return _iHeapVec[nSlotID];
+}
+
+uint8_t FreeSpacePage::GetBucket(SlotID nSlotID) const {
+  if (nSlotID >= _iBucketVec.size()) throw RecordPageException(nSlotID);
+  return _iBucketVec[nSlotID];
+}
+
+Size FreeSpacePage::GetUsed() const { return _iHeapVec.size(); }
+
+bool FreeSpacePage::Full() const { return _iHeapVec.size() >= GetCap(); }
+
+}  // namespace thdb
@@ -0,0 +1,57 @@
+#ifndef THDB_FREE_SPACE_PAGE_H_
+#define THDB_FREE_SPACE_PAGE_H_
+
+#include <vector>
+
+#include "page/linked_page.h"
+
+namespace thdb {
+
+/**
+ * @brief 空闲空间映射页面。
+ * 按表页面链表的顺序记录若干数据页面的编号和剩余空间分级，
+ * 数据部分先存放页面编号数组，再存放每个页面1字节的分级数组。
+ */
+class FreeSpacePage : public LinkedPage {
+ public:
+  /**
+   * @brief 在nOwner的区段中构建一个新的空闲空间映射页面
+   * @param nOwner 所属表的页面编号
+   */
+  FreeSpacePage(PageID nOwner, NewPageTag);
+  /**
+   * @brief 从MiniOS中重新导入一个空闲空间映射页面
+   * @param nPageID 页面编号
+   */
+  FreeSpacePage(PageID nPageID);
+  ~FreeSpacePage();
+
+  /**
+   * @brief 追加一个数据页面的记录
+   *
+   * @param nHeapID 数据页面编号
+   * @param nBucket 剩余空间分级
+   * @return SlotID 记录所在位置
+   */
+  SlotID Append(PageID nHeapID, uint8_t nBucket);
+  void SetBucket(SlotID nSlotID, uint8_t nBucket);
+
+  PageID GetHeapID(SlotID nSlotID) const;
+  uint8_t GetBucket(SlotID nSlotID) const;
+  Size GetUsed() const;
+  bool Full() const;
+
+  /**
+   * @brief 获得当前页面大小下每个页面能记录的数据页面数量
+   */
+  static Size GetCap();
+
+ private:
+  std::vector<PageID> _iHeapVec;
+  std::vector<uint8_t> _iBucketVec;
+  bool _bDirty;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_FREE_SPACE_PAGE_H_
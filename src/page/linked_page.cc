@@ -2,29 +2,42 @@
 
 #include "macros.h"
 #include "minios/os.h"
+#include "page/page_guard.h"
 
 namespace thdb {
 
-const PageOffset NEXT_PAGE_OFFSET = 4;
-const PageOffset PREV_PAGE_OFFSET = 8;
-
 LinkedPage::LinkedPage() : Page() {
   this->_bModified = true;
   this->_nNextID = NULL_PAGE;
   this->_nPrevID = NULL_PAGE;
 }
 
+LinkedPage::LinkedPage(PageID nOwner, NewPageTag) : Page(nOwner, NEW_PAGE) {
+  this->_bModified = true;
+  this->_nNextID = NULL_PAGE;
+  this->_nPrevID = NULL_PAGE;
+}
+
+LinkedPage::LinkedPage(PageID nPageID, PageID nNextID, PageID nPrevID)
+    : Page(nPageID) {
+  this->_bModified = false;
+  this->_nNextID = nNextID;
+  this->_nPrevID = nPrevID;
+}
+
 LinkedPage::LinkedPage(PageID nPageID) : Page(nPageID) {
   this->_bModified = false;
-  GetHeader((uint8_t *)&_nNextID, 4, NEXT_PAGE_OFFSET);
-  GetHeader((uint8_t *)&_nPrevID, 4, PREV_PAGE_OFFSET);
+  ReadPageGuard iGuard(nPageID);
+  _nNextID = iGuard.GetHeader<PageID>(NEXT_PAGE_OFFSET);
+  _nPrevID = iGuard.GetHeader<PageID>(PREV_PAGE_OFFSET);
 }
 
 LinkedPage::~LinkedPage() {
   if (_bModified) {
     // Dirty Page Condition
-    SetHeader((uint8_t *)&_nNextID, 4, NEXT_PAGE_OFFSET);
-    SetHeader((uint8_t *)&_nPrevID, 4, PREV_PAGE_OFFSET);
+    WritePageGuard iGuard(_nPageID);
+    iGuard.SetHeader(NEXT_PAGE_OFFSET, _nNextID);
+    iGuard.SetHeader(PREV_PAGE_OFFSET, _nPrevID);
   }
 }
 
@@ -6,6 +6,9 @@
 
 namespace thdb {
 
+const PageOffset NEXT_PAGE_OFFSET = 4;
+const PageOffset PREV_PAGE_OFFSET = 8;
+
 /**
  * @brief 链表结点页面。
  * 
@@ -14,6 +17,14 @@ class LinkedPage : public Page {
  public:
   LinkedPage();
   LinkedPage(PageID nPageID);
+  /**
+   * @brief 在nOwner的区段中构建一个新的链表结点页面
+   */
+  LinkedPage(PageID nOwner, NewPageTag);
+  /**
+   * @brief 导入一个前后页面编号已知的链表结点页面，不读取页面
+   */
+  LinkedPage(PageID nPageID, PageID nNextID, PageID nPrevID);
   virtual ~LinkedPage();
 
   /**
@@ -3,10 +3,15 @@
 #include <assert.h>
 #include <float.h>
 
+#include <cstring>
+
 #include "exception/exceptions.h"
 #include "field/fields.h"
 #include "macros.h"
 #include "minios/os.h"
+#include "page/decoded_cache.h"
+#include "page/page_guard.h"
+#include "settings.h"
 
 namespace thdb {
 
@@ -14,12 +19,36 @@ const PageOffset LEAF_OFFSET = 8;
 const PageOffset USED_SLOT_OFFSET = 12;
 const PageOffset KEY_LEN_OFFSET = 16;
 const PageOffset KEY_TYPE_OFFSET = 20;
+const PageOffset OWNER_OFFSET = 24;
+
+/**
+ * @brief 结点页面的解码结果，由缓存和各个NodePage对象共享，创建后不再修改
+ */
+struct NodeImage {
+  Size nKeyLen;
+  FieldType iKeyType;
+  PageID nOwner;
+  std::vector<Field *> iKeyVec;
+  std::vector<PageSlotID> iDataVec;
+  std::vector<PageID> iChildVec;
+  ~NodeImage() {
+    for (Field *pKey : iKeyVec) delete pKey;
+  }
+};
+
+DecodedCache<NodeImage> &NodeCache() {
+  static DecodedCache<NodeImage> iCache(DECODED_CACHE_PAGES);
+  return iCache;
+}
 
 NodePage::NodePage(Size nKeyLen, FieldType iKeyType)
     : _nKeyLen(nKeyLen), _iKeyType(iKeyType) {
   // TODO: 基于自己实现的Store算法确定最大容量
+  _nOwner = _nPageID;
+  Modify();
   _nUsed = 0;
-  _nCap = (DATA_SIZE - sizeof(PageID)) /
+  PageOffset nDataSize = MiniOS::GetOS()->GetDataSize();
+  _nCap = (nDataSize - sizeof(PageID)) /
               (_nKeyLen + sizeof(PageSlotID) + sizeof(PageID)) -
           1;
 }
@@ -27,14 +56,18 @@ NodePage::NodePage(Size nKeyLen, FieldType iKeyType)
 NodePage::NodePage(Size nKeyLen, FieldType iKeyType,
                    const std::vector<Field *> &iDataKeyVec,
                    const std::vector<PageSlotID> &iDataVec,
-                   const std::vector<PageID> &iChildVec)
-    : _nKeyLen(nKeyLen),
+                   const std::vector<PageID> &iChildVec, PageID nOwner)
+    : Page(nOwner, NEW_PAGE),
+      _nKeyLen(nKeyLen),
       _iKeyType(iKeyType),
+      _nOwner(nOwner),
       _iDataKeyVec(iDataKeyVec),
       _iDataVec(iDataVec),  // TODO: 基于自己实现的Store算法确定最大容量
       _iChildVec(iChildVec) {
+  Modify();
   _nUsed = _iDataKeyVec.size();
-  _nCap = (DATA_SIZE - sizeof(PageID)) /
+  PageOffset nDataSize = MiniOS::GetOS()->GetDataSize();
+  _nCap = (nDataSize - sizeof(PageID)) /
               (_nKeyLen + sizeof(PageSlotID) + sizeof(PageID)) -
           1;
 }
@@ -43,17 +76,46 @@ NodePage::NodePage(PageID nPageID) : Page(nPageID) {
   // TODO: 从格式化页面中导入结点信息
   // TODO: 确定最大容量
   Load();
+  PageOffset nDataSize = MiniOS::GetOS()->GetDataSize();
   _nCap =
-      (DATA_SIZE - sizeof(PageSlotID)) / (_nKeyLen + sizeof(PageSlotID)) + 1;
+      (nDataSize - sizeof(PageSlotID)) / (_nKeyLen + sizeof(PageSlotID)) + 1;
 }
 
 NodePage::~NodePage() {
   // TODO: 将结点信息格式化并写回到页面中
   // TODO: 注意析构KeyVec中的指针
-  if (removed == false) {
+  if (removed == false && _bDirty) {
     Store();
+    // 写回后的结点内容即为新的解码结果，直接交给缓存，Key随之转交
+    std::shared_ptr<NodeImage> pImage = std::make_shared<NodeImage>();
+    pImage->nKeyLen = _nKeyLen;
+    pImage->iKeyType = _iKeyType;
+    pImage->nOwner = _nOwner;
+    pImage->iKeyVec.swap(_iDataKeyVec);
+    pImage->iDataVec.swap(_iDataVec);
+    pImage->iChildVec.swap(_iChildVec);
+    NodeCache().Put(_nPageID, pImage);
   }
-  for (Field *i : _iDataKeyVec) delete i;
+  // 与缓存共享的Key由解码结果负责释放
+  if (!_bShared)
+    for (Field *i : _iDataKeyVec) delete i;
+}
+
+void NodePage::Modify() {
+  _bDirty = true;
+  if (!_bShared) return;
+  _bShared = false;
+  // 解码结果只被缓存和本对象持有时，移出缓存并直接接管其中的Key，
+  // 避免每次修改都复制整个结点。
+  NodeCache().OnPageChanged(_nPageID);
+  if (_pImage.use_count() == 1) {
+    std::const_pointer_cast<NodeImage>(_pImage)->iKeyVec.clear();
+    _pImage.reset();
+    return;
+  }
+  // 否则复制共享的Key，其他对象手中的解码结果保持不变。
+  // 解码结果在对象析构前一直持有，调用者手中的共享Key不会失效。
+  for (Field *&pKey : _iDataKeyVec) pKey = pKey->Copy();
 }
 
 bool NodePage::Insert(Field *pKey, const PageSlotID &iPair) {
@@ -65,12 +127,14 @@ bool NodePage::Insert(Field *pKey, const PageSlotID &iPair) {
   // 3.判断子节点是否为满结点，满结点时执行分裂
   if (pKey == NULL) return false;
   if (Empty()) {
+    Modify();
     _iDataKeyVec.push_back(pKey->Copy());
     _iDataVec.push_back(iPair);
     return true;
   }
   Size insert_pos = LowerBound(pKey);
   if (_iChildVec.size() == 0) {  //叶节点
+    Modify();
     _iDataKeyVec.insert(_iDataKeyVec.begin() + insert_pos, pKey->Copy());
     _iDataVec.insert(_iDataVec.begin() + insert_pos, iPair);
     return true;
@@ -78,13 +142,15 @@ bool NodePage::Insert(Field *pKey, const PageSlotID &iPair) {
   NodePage child_node = NodePage(_iChildVec[insert_pos]);
   child_node.Insert(pKey, iPair);
   if (child_node.Full()) {
+    Modify();
     std::vector<Field *> newDataKeyVec;
     std::vector<PageSlotID> newDataVec;
     std::vector<PageID> newChildVec;
     std::pair<Field *, PageSlotID> ascend_node =
         child_node.PopHalf(newDataKeyVec, newDataVec, newChildVec);
     NodePage new_child =
-        NodePage(_nKeyLen, _iKeyType, newDataKeyVec, newDataVec, newChildVec);
+        NodePage(_nKeyLen, _iKeyType, newDataKeyVec, newDataVec, newChildVec,
+                 _nOwner);
     _iDataKeyVec.insert(_iDataKeyVec.begin() + insert_pos, ascend_node.first);
     _iDataVec.insert(_iDataVec.begin() + insert_pos, ascend_node.second);
     _iChildVec.insert(_iChildVec.begin() + insert_pos + 1,
@@ -114,6 +180,7 @@ Size NodePage::Delete(Field *pKey) {
   Size ans = 0;
   if (_iChildVec.size() == 0) {  //叶子节点
     for (Size i = lower; i < upper; ++i) {
+      Modify();
       ans += 1;
       delete _iDataKeyVec[i];
       _iDataKeyVec.erase(_iDataKeyVec.begin() + i);
@@ -127,6 +194,7 @@ Size NodePage::Delete(Field *pKey) {
       Size child_delete = child.Delete(pKey);
       ans += child_delete;
       if (child.Empty()) {
+        Modify();
         Size pair = i < _nUsed ? i : i - 1;
         Field *pair_key = _iDataKeyVec[pair];
         PageSlotID pair_val = _iDataVec[pair];
@@ -145,10 +213,12 @@ Size NodePage::Delete(Field *pKey) {
       }
     }
     for (Size i = lower; i < upper; ++i) {  //在节点上
+      Modify();
       ans += 1;
       delete _iDataKeyVec[i];
       NodePage next = NodePage(_iChildVec[i + 1]);
-      Field *next_key = next.FirstKey();
+      // next删除首个Key时会释放它，这里需要保留一份副本
+      Field *next_key = next.FirstKey()->Copy();
       PageSlotID next_val = next.FirstValue();
       ans += next.Delete(next.FirstKey(), next.FirstValue());
       if (next.Empty()) {
@@ -157,12 +227,14 @@ Size NodePage::Delete(Field *pKey) {
         _iDataVec.erase(_iDataVec.begin() + i);
         if (MergeWithChild()) {
           Insert(next_key, next_val);
+          delete next_key;
           ans += Delete(pKey);
           return ans;
         }
         MiniOS::GetOS()->DeletePage(next.GetPageID());
         next.removed = true;
         Insert(next_key, next_val);
+        delete next_key;
       } else {
         _iDataKeyVec[i] = next_key;
         _iDataVec[i] = next_val;
@@ -191,6 +263,7 @@ bool NodePage::Delete(Field *pKey, const PageSlotID &iPair) {
   if (_iChildVec.size() == 0) {  //叶子节点
     for (Size i = lower; i < upper; ++i) {
       if (_iDataVec[i] == iPair) {
+        Modify();
         delete _iDataKeyVec[i];
         _iDataKeyVec.erase(_iDataKeyVec.begin() + i);
         _iDataVec.erase(_iDataVec.begin() + i);
@@ -200,20 +273,24 @@ bool NodePage::Delete(Field *pKey, const PageSlotID &iPair) {
   } else {  //中间节点
     for (Size i = lower; i < upper; ++i) {
       if (_iDataVec[i] == iPair) {  //在节点上
+        Modify();
         delete _iDataKeyVec[i];
         NodePage next = NodePage(_iChildVec[i + 1]);
-        Field *next_key = next.FirstKey();
+        Field *next_key = next.FirstKey()->Copy();
         PageSlotID next_val = next.FirstValue();
         next.Delete(next.FirstKey(), next.FirstValue());
         if (next.Empty()) {
           _iChildVec.erase(_iChildVec.begin() + i + 1);
           _iDataKeyVec.erase(_iDataKeyVec.begin() + i);
           _iDataVec.erase(_iDataVec.begin() + i);
-          MergeWithChild();
+          // 只有被清空的子结点才能释放，仍有数据的子结点必须保留
+          if (!MergeWithChild()) {
+            MiniOS::GetOS()->DeletePage(next.GetPageID());
+            next.removed = true;
+          }
           Insert(next_key, next_val);
+          delete next_key;
         } else {
-          MiniOS::GetOS()->DeletePage(next.GetPageID());
-          next.removed = true;
           _iDataKeyVec[i] = next_key;
           _iDataVec[i] = next_val;
         }
@@ -224,6 +301,7 @@ bool NodePage::Delete(Field *pKey, const PageSlotID &iPair) {
       NodePage child = NodePage(_iChildVec[i]);
       if (child.Delete(pKey, iPair)) {
         if (child.Empty()) {
+          Modify();
           Size pair = i < _nUsed ? i : i - 1;
           Field *pair_key = _iDataKeyVec[pair];
           PageSlotID pair_val = _iDataVec[pair];
@@ -260,6 +338,7 @@ bool NodePage::Update(Field *pKey, const PageSlotID &iOld,
   if (_iChildVec.size() == 0) {  //叶子节点
     for (Size i = lower; i < upper; ++i) {
       if (_iDataVec[i] == iOld) {
+        Modify();
         _iDataVec[i] = iNew;
         return true;
       }
@@ -267,6 +346,7 @@ bool NodePage::Update(Field *pKey, const PageSlotID &iOld,
   } else {  //中间节点
     for (Size i = lower; i < upper; ++i) {
       if (_iDataVec[i] == iOld) {  //在节点上
+        Modify();
         _iDataVec[i] = iNew;
         return true;
       }
@@ -334,6 +414,7 @@ std::vector<PageSlotID> NodePage::Search(Field *key) {
 }
 
 bool NodePage::InsertChild(Size insertPos, const PageID pageID) {
+  Modify();
   _iChildVec.insert(_iChildVec.begin() + insertPos, pageID);
   return true;
 }
@@ -342,6 +423,7 @@ void NodePage::Clear() {
   // TODO: 需要基于结点类型判断执行过程
   // 叶结点：直接释放占用空间
   // 中间结点：先释放子结点空间，之后释放自身占用空间
+  Modify();
   for (auto i : _iChildVec) {
     NodePage child = NodePage(i);
     child.Clear();
@@ -360,6 +442,7 @@ bool NodePage::Empty() const { return _iDataKeyVec.size() == 0; }
 
 FieldType NodePage::GetType() const { return _iKeyType; }
 Size NodePage::GetKeyLen() const { return _nKeyLen; }
+PageID NodePage::GetOwner() const { return _nOwner; }
 
 Field *NodePage::FirstKey() const {
   if (Empty()) return nullptr;
@@ -374,6 +457,7 @@ PageSlotID NodePage::FirstValue() const {
 std::pair<Field *, PageSlotID> NodePage::PopHalf(
     std::vector<Field *> &newDataKeyVec, std::vector<PageSlotID> &newDataVec,
     std::vector<PageID> &newChildVec) {
+  Modify();
   Size mid = _nCap / 2;
   for (auto it = _iDataKeyVec.begin() + mid + 1; it != _iDataKeyVec.end();) {
     newDataKeyVec.push_back(*it);
@@ -399,19 +483,44 @@ std::pair<Field *, PageSlotID> NodePage::PopHalf(
 void NodePage::Load() {
   // TODO: 从格式化页面数据中导入结点信息
   // TODO: 自行设计，注意和Store匹配
-  Size _bLeaf = 0;
-  GetHeader((uint8_t *)&_bLeaf, sizeof(Size), LEAF_OFFSET);
-  GetHeader((uint8_t *)&_nUsed, sizeof(Size), USED_SLOT_OFFSET);
-  GetHeader((uint8_t *)&_nKeyLen, sizeof(Size), KEY_LEN_OFFSET);
-  GetHeader((uint8_t *)&_iKeyType, sizeof(Size), KEY_TYPE_OFFSET);
-  if (_nUsed == 0) return;
+  // 命中缓存时直接共享解码结果，不再为每个Key分配Field对象
+  _pImage = NodeCache().Get(_nPageID);
+  if (!_pImage) {
+    std::shared_ptr<const NodeImage> pImage = Decode();
+    NodeCache().Put(_nPageID, pImage);
+    _pImage = pImage;
+  }
+  _nKeyLen = _pImage->nKeyLen;
+  _iKeyType = _pImage->iKeyType;
+  _nOwner = _pImage->nOwner;
+  _iDataKeyVec = _pImage->iKeyVec;
+  _iDataVec = _pImage->iDataVec;
+  _iChildVec = _pImage->iChildVec;
+  _nUsed = _iDataKeyVec.size();
+  _bShared = true;
+}
+
+std::shared_ptr<const NodeImage> NodePage::Decode() const {
+  // 固定页面一次，Key、Value、子结点均直接从页面中解码
+  std::shared_ptr<NodeImage> pImage = std::make_shared<NodeImage>();
+  ReadPageGuard iGuard(_nPageID);
+  const uint8_t *pData = iGuard.GetDataView();
+  Size _bLeaf = iGuard.GetHeader<Size>(LEAF_OFFSET);
+  Size nUsed = iGuard.GetHeader<Size>(USED_SLOT_OFFSET);
+  Size nKeyLen = iGuard.GetHeader<Size>(KEY_LEN_OFFSET);
+  FieldType iKeyType = (FieldType)iGuard.GetHeader<Size>(KEY_TYPE_OFFSET);
+  pImage->nKeyLen = nKeyLen;
+  pImage->iKeyType = iKeyType;
+  pImage->nOwner = iGuard.GetHeader<PageID>(OWNER_OFFSET);
+  // 旧版本结点未记录所有者，页面0为系统页面，不会是索引结点
+  if (pImage->nOwner == 0) pImage->nOwner = _nPageID;
+  if (nUsed == 0) return pImage;
 
   PageOffset key_begin = 0;
-  uint8_t *key_data = new uint8_t[_nKeyLen];
-  for (Size i = 0; i < _nUsed; ++i) {
-    GetData((uint8_t *)key_data, _nKeyLen, key_begin + i * _nKeyLen);
+  pImage->iKeyVec.reserve(nUsed);
+  for (Size i = 0; i < nUsed; ++i) {
     Field *key = NULL;
-    switch (_iKeyType) {
+    switch (iKeyType) {
       case FieldType::FLOAT_TYPE:
         key = new FloatField;
         break;
@@ -419,62 +528,58 @@ void NodePage::Load() {
         key = new IntField;
         break;
       case FieldType::STRING_TYPE:
-        key = new StringField(_nKeyLen);
+        key = new StringField(nKeyLen);
         break;
       default:
         break;
     }
-    key->SetData(key_data, _nKeyLen);
-    _iDataKeyVec.push_back(key);
+    key->SetData(pData + key_begin + i * nKeyLen, nKeyLen);
+    pImage->iKeyVec.push_back(key);
   }
 
-  PageOffset val_begin = _nUsed * _nKeyLen;
-  PageSlotID *val_data;
-  val_data = new PageSlotID[_nUsed];
-  GetData((uint8_t *)val_data, sizeof(PageSlotID) * _nUsed, val_begin);
-  _iDataVec.insert(_iDataVec.begin(), val_data, val_data + _nUsed);
-
-  delete key_data;
-  delete val_data;
+  PageOffset val_begin = nUsed * nKeyLen;
+  pImage->iDataVec.resize(nUsed);
+  memcpy((uint8_t *)pImage->iDataVec.data(), pData + val_begin,
+         sizeof(PageSlotID) * nUsed);
 
   if (_bLeaf > 0) {
-    PageOffset child_begin = val_begin + _nUsed * sizeof(PageSlotID);
-    PageID *child_data;
-    child_data = new PageID[_bLeaf];
-    GetData((uint8_t *)child_data, sizeof(PageID) * _bLeaf, child_begin);
-    _iChildVec.insert(_iChildVec.begin(), child_data, child_data + _bLeaf);
-    delete child_data;
+    PageOffset child_begin = val_begin + nUsed * sizeof(PageSlotID);
+    pImage->iChildVec.resize(_bLeaf);
+    memcpy(pImage->iChildVec.data(), pData + child_begin,
+           sizeof(PageID) * _bLeaf);
   }
+  return pImage;
 }
 
 void NodePage::Store() {
   // TODO: 格式化结点信息并保存到页面中
   // TODO: 自行设计，注意和Load匹配
+  WritePageGuard iGuard(_nPageID);
   Size _bLeaf = _iChildVec.size();
   _nUsed = _iDataKeyVec.size();
-  SetHeader((uint8_t *)&_bLeaf, sizeof(Size), LEAF_OFFSET);
-  SetHeader((uint8_t *)&_nUsed, sizeof(Size), USED_SLOT_OFFSET);
-  SetHeader((uint8_t *)&_nKeyLen, sizeof(Size), KEY_LEN_OFFSET);
-  SetHeader((uint8_t *)&_iKeyType, sizeof(Size), KEY_TYPE_OFFSET);
+  iGuard.SetHeader(LEAF_OFFSET, _bLeaf);
+  iGuard.SetHeader(USED_SLOT_OFFSET, _nUsed);
+  iGuard.SetHeader(KEY_LEN_OFFSET, _nKeyLen);
+  iGuard.SetHeader(KEY_TYPE_OFFSET, (Size)_iKeyType);
+  iGuard.SetHeader(OWNER_OFFSET, _nOwner);
 
+  uint8_t *pData = iGuard.GetMutableData();
   PageOffset key_begin = 0;
-  uint8_t *data = new uint8_t[_nKeyLen];
-  for (Size i = 0; i < _iDataKeyVec.size(); ++i) {
-    _iDataKeyVec[i]->GetData(data, _nKeyLen);
-    SetData(data, _nKeyLen, key_begin + i * _nKeyLen);
-  }
+  for (Size i = 0; i < _iDataKeyVec.size(); ++i)
+    _iDataKeyVec[i]->GetData(pData + key_begin + i * _nKeyLen, _nKeyLen);
 
   PageOffset val_begin = _nUsed * _nKeyLen;
-  SetData((uint8_t *)_iDataVec.data(), sizeof(PageSlotID) * _nUsed, val_begin);
+  memcpy(pData + val_begin, _iDataVec.data(), sizeof(PageSlotID) * _nUsed);
 
   if (_bLeaf > 0) {
     PageOffset child_begin = val_begin + _nUsed * sizeof(PageSlotID);
-    SetData((uint8_t *)_iChildVec.data(), sizeof(PageID) * _bLeaf, child_begin);
+    memcpy(pData + child_begin, _iChildVec.data(), sizeof(PageID) * _bLeaf);
   }
 }
 
 bool NodePage::MergeWithChild() {
   if (_iChildVec.size() >= 2) return false;
+  Modify();
   NodePage child = NodePage(_iChildVec[0]);
   Field *my_key = FirstKey();
   PageSlotID my_val = FirstValue();
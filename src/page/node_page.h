@@ -1,6 +1,8 @@
 #ifndef THDB_NODE_PAGE_H_
 #define THDB_NODE_PAGE_H_
 
+#include <memory>
+
 #include "defines.h"
 #include "field/field.h"
 #include "page/page.h"
@@ -8,6 +10,7 @@
 namespace thdb {
 
 class Index;
+struct NodeImage;
 
 /**
  * @brief 同时表示了中间结点和叶结点。
@@ -30,11 +33,12 @@ class NodePage : public Page {
    * @param iDataKeyVec 数据结点的Key值
    * @param iDataVec 数据结点的Value值
    * @param iChildVec 子结点的Value值
+   * @param nOwner 所属索引的区段所有者，新结点在其区段中分配
    */
   NodePage(Size nKeyLen, FieldType iKeyType,
            const std::vector<Field *> &iDataKeyVec,
            const std::vector<PageSlotID> &iDataVec,
-           const std::vector<PageID> &iChildVec);
+           const std::vector<PageID> &iChildVec, PageID nOwner);
   /**
    * @brief 导入一个已经存在的页面结点。
    *
@@ -128,6 +132,11 @@ class NodePage : public Page {
    */
   Size GetKeyLen() const;
 
+  /**
+   * @brief 获得结点所属索引的区段所有者
+   */
+  PageID GetOwner() const;
+
   /**
    * @brief 分裂当前结点，清除当前结点中后一半的结点。
    * @return std::pair<Field *, PageSlotID>
@@ -146,6 +155,14 @@ class NodePage : public Page {
    * @brief 将结点信息保存为格式化的页面数据。
    */
   void Store();
+  /**
+   * @brief 从页面中解码出一份新的结点解码结果
+   */
+  std::shared_ptr<const NodeImage> Decode() const;
+  /**
+   * @brief 在修改结点之前调用，标记结点需要写回，并放弃与缓存共享的Key
+   */
+  void Modify();
 
   bool MergeWithChild();
   void Copy(NodePage *copy);
@@ -190,6 +207,10 @@ class NodePage : public Page {
    * @brief 结点页面Key的类型
    */
   FieldType _iKeyType;
+  /**
+   * @brief 区段所有者，同一索引的结点共享，取为索引第一个根结点的页面编号
+   */
+  PageID _nOwner;
 
   /**
    * @brief Key数组，用于存储类型为Field*的数据Key
@@ -205,6 +226,18 @@ class NodePage : public Page {
   std::vector<PageID> _iChildVec;
   friend class Index;
   bool removed = false;
+  /**
+   * @brief 结点内容是否被修改，未修改时析构不写回页面
+   */
+  bool _bDirty = false;
+  /**
+   * @brief 导入结点时使用的解码结果，与缓存共享
+   */
+  std::shared_ptr<const NodeImage> _pImage;
+  /**
+   * @brief _iDataKeyVec中的Key是否归_pImage所有
+   */
+  bool _bShared = false;
 };
 
 }  // namespace thdb
@@ -0,0 +1,88 @@
+#include "page/overflow_page.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "exception/exceptions.h"
+#include "macros.h"
+#include "minios/os.h"
+#include "page/page_guard.h"
+
+namespace thdb {
+
+const PageOffset OVERFLOW_USED_OFFSET = 12;
+
+OverflowPage::OverflowPage() : LinkedPage() {
+  _nUsed = 0;
+  _bDirty = true;
+}
+
+OverflowPage::OverflowPage(PageID nPageID) : LinkedPage(nPageID) {
+  _bDirty = false;
+  ReadPageGuard iGuard(nPageID);
+  _nUsed = iGuard.GetHeader<Size>(OVERFLOW_USED_OFFSET);
+}
+
+OverflowPage::~OverflowPage() {
+  if (!_bDirty) return;
+  WritePageGuard iGuard(_nPageID);
+  iGuard.SetHeader(OVERFLOW_USED_OFFSET, _nUsed);
+}
+
+void OverflowPage::SetContent(const uint8_t *src, Size nSize) {
+  if (nSize > GetCap()) throw ToastPageFullException();
+  _bDirty = true;
+  _nUsed = nSize;
+  SetData(src, nSize, 0);
+}
+
+Size OverflowPage::GetContent(uint8_t *dst) const {
+  memcpy(dst, GetDataView(), _nUsed);
+  return _nUsed;
+}
+
+Size OverflowPage::GetUsed() const { return _nUsed; }
+
+Size OverflowPage::GetCap() { return MiniOS::GetOS()->GetDataSize(); }
+
+PageID OverflowPage::WriteChain(const uint8_t *src, Size nSize) {
+  // 按顺序分配页面，空闲页面连续时链上的页面也连续，读取时可以顺序预读
+  OverflowPage *pPage = new OverflowPage();
+  PageID nFirst = pPage->GetPageID();
+  Size nDone = 0;
+  while (true) {
+    Size nPart = std::min(nSize - nDone, GetCap());
+    pPage->SetContent(src + nDone, nPart);
+    nDone += nPart;
+    if (nDone == nSize) break;
+    OverflowPage *pNext = new OverflowPage();
+    pPage->SetNextID(pNext->GetPageID());
+    pNext->SetPrevID(pPage->GetPageID());
+    delete pPage;
+    pPage = pNext;
+  }
+  delete pPage;
+  return nFirst;
+}
+
+void OverflowPage::ReadChain(PageID nPageID, uint8_t *dst, Size nSize) {
+  Size nDone = 0;
+  while (nDone < nSize) {
+    if (nPageID == NULL_PAGE) throw PageNotInitException(nPageID);
+    MiniOS::GetOS()->ReadAhead(nPageID);
+    OverflowPage iPage(nPageID);
+    if (nDone + iPage.GetUsed() > nSize) throw PageNotInitException(nPageID);
+    nDone += iPage.GetContent(dst + nDone);
+    nPageID = iPage.GetNextID();
+  }
+}
+
+void OverflowPage::FreeChain(PageID nPageID) {
+  while (nPageID != NULL_PAGE) {
+    PageID nNextID = OverflowPage(nPageID).GetNextID();
+    MiniOS::GetOS()->DeletePage(nPageID);
+    nPageID = nNextID;
+  }
+}
+
+}  // namespace thdb
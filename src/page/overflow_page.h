@@ -0,0 +1,67 @@
+#ifndef THDB_OVERFLOW_PAGE_H_
+#define THDB_OVERFLOW_PAGE_H_
+
+#include "page/linked_page.h"
+
+namespace thdb {
+
+/**
+ * @brief 溢出页面。
+ * 超过阈值的字符串字段移出数据页面，按页面大小切分后存放在一条溢出页面链中，
+ * 数据页面中的记录只保留指向链首的ToastPointer。
+ * 每个页面的数据部分从头开始连续存放一段内容，头部记录这段内容的长度。
+ */
+class OverflowPage : public LinkedPage {
+ public:
+  /**
+   * @brief 构建一个新的溢出页面。
+   * 溢出页面随更新频繁分配和释放，不使用表的区段，而是直接复用编号最小的
+   * 空闲页面，避免释放的页面因凑不满整个区段而无法再被分配。
+   */
+  OverflowPage();
+  /**
+   * @brief 从MiniOS中重新导入一个溢出页面
+   * @param nPageID 页面编号
+   */
+  OverflowPage(PageID nPageID);
+  ~OverflowPage();
+
+  /**
+   * @brief 写入本页存放的内容，nSize不能超过GetCap
+   */
+  void SetContent(const uint8_t *src, Size nSize);
+  /**
+   * @brief 读出本页存放的内容
+   *
+   * @return Size 本页存放的内容长度
+   */
+  Size GetContent(uint8_t *dst) const;
+  Size GetUsed() const;
+
+  /**
+   * @brief 获得当前页面大小下每个页面能存放的内容长度
+   */
+  static Size GetCap();
+  /**
+   * @brief 将一段内容写入新建的溢出页面链
+   *
+   * @return PageID 溢出页面链的首页编号
+   */
+  static PageID WriteChain(const uint8_t *src, Size nSize);
+  /**
+   * @brief 从溢出页面链中读出nSize字节内容
+   */
+  static void ReadChain(PageID nPageID, uint8_t *dst, Size nSize);
+  /**
+   * @brief 释放整条溢出页面链
+   */
+  static void FreeChain(PageID nPageID);
+
+ private:
+  Size _nUsed;
+  bool _bDirty;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_OVERFLOW_PAGE_H_
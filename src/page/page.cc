@@ -12,16 +12,37 @@ Page::Page() {
   this->_nPageID = MiniOS::GetOS()->NewPage();
 }
 
+Page::Page(PageID nOwner, NewPageTag) {
+  this->_bModified = true;
+  this->_nPageID = MiniOS::GetOS()->NewPage(nOwner);
+}
+
 Page::Page(PageID nPageID) {
   this->_bModified = false;
   this->_nPageID = nPageID;
 }
 
-Page::~Page() {}
+Page::Page(const Page &iPage)
+    : _nPageID(iPage._nPageID), _bModified(iPage._bModified) {}
+
+Page &Page::operator=(const Page &iPage) {
+  if (this == &iPage) return *this;
+  if (_bPinned) MiniOS::GetOS()->Unpin(_nPageID, false);
+  _bPinned = false;
+  _nPageID = iPage._nPageID;
+  _bModified = iPage._bModified;
+  return *this;
+}
+
+Page::~Page() {
+  if (_bPinned) MiniOS::GetOS()->Unpin(_nPageID, false);
+}
 
 uint32_t Page::GetPageID() const { return _nPageID; }
 
 void Page::SetPageID(PageID nPageID) {
+  if (_bPinned) MiniOS::GetOS()->Unpin(_nPageID, false);
+  _bPinned = false;
   this->_nPageID = nPageID;
   this->_bModified = true;
 }
@@ -44,4 +65,16 @@ void Page::SetData(const uint8_t *src, PageOffset nSize, PageOffset nOffset) {
   this->_bModified = true;
 }
 
+const uint8_t *Page::GetHeaderView() const {
+  if (!_bPinned) {
+    MiniOS::GetOS()->Pin(_nPageID);
+    _bPinned = true;
+  }
+  return MiniOS::GetOS()->View(_nPageID);
+}
+
+const uint8_t *Page::GetDataView() const {
+  return GetHeaderView() + DATA_BEGIN_OFFSET;
+}
+
 }  // namespace thdb
@@ -4,15 +4,32 @@
 #include "defines.h"
 
 namespace thdb {
+/**
+ * @brief 新建页面构造函数的标记类型，与按页面编号打开已有页面的构造函数区分
+ */
+struct NewPageTag {};
+const NewPageTag NEW_PAGE = NewPageTag();
+
 /**
  * @brief 最为基本的格式化页面对象，实现了基本的页面内容读写操作。
- * 对于页面划分为头和数据两部分，页面合计占用4096字节，其中头部分占用64字节，在macros.h中进行了定义。
+ * 对于页面划分为头和数据两部分，页面大小在创建数据库时确定并记录在页面文件头中，
+ * 其中头部分占用64字节，在macros.h中进行了定义。
  */
 class Page {
  public:
   Page();
   Page(PageID nPageID);
+  /**
+   * @brief 在nOwner的区段中构建一个新页面
+   * @param nOwner 所有者的页面编号
+   */
+  Page(PageID nOwner, NewPageTag);
   virtual ~Page();
+  /**
+   * @brief 复制页面对象，副本不继承视图对页面的固定
+   */
+  Page(const Page &iPage);
+  Page &operator=(const Page &iPage);
 
   PageID GetPageID() const;
   void SetPageID(PageID nPageID);
@@ -51,11 +68,25 @@ class Page {
    */
   void SetData(const uint8_t *src, PageOffset nSize, PageOffset nOffset);
 
+  /**
+   * @brief 获得页面头部分的只读视图。
+   * 首次获取视图时固定页面，直到页面对象析构，视图在此期间始终有效。
+   */
+  const uint8_t *GetHeaderView() const;
+  /**
+   * @brief 获得页面数据部分的只读视图，有效期与GetHeaderView相同。
+   */
+  const uint8_t *GetDataView() const;
+
  protected:
   PageID _nPageID;
 
  private:
   bool _bModified;
+  /**
+   * @brief 页面是否因获取视图而被固定
+   */
+  mutable bool _bPinned = false;
 };
 
 }  // namespace thdb
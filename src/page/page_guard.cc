@@ -0,0 +1,27 @@
+#include "page/page_guard.h"
+
+#include "minios/os.h"
+
+namespace thdb {
+
+ReadPageGuard::ReadPageGuard(PageID nPageID) : _nPageID(nPageID) {
+  _pPage = MiniOS::GetOS()->Pin(nPageID);
+}
+
+ReadPageGuard::~ReadPageGuard() { MiniOS::GetOS()->Unpin(_nPageID, false); }
+
+WritePageGuard::WritePageGuard(PageID nPageID)
+    : _nPageID(nPageID), _bModified(false) {
+  _pPage = MiniOS::GetOS()->Pin(nPageID);
+}
+
+WritePageGuard::~WritePageGuard() {
+  MiniOS::GetOS()->Unpin(_nPageID, _bModified);
+}
+
+uint8_t *WritePageGuard::GetMutableData() {
+  _bModified = true;
+  return _pPage + HEADER_SIZE;
+}
+
+}  // namespace thdb
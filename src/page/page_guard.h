@@ -0,0 +1,83 @@
+#ifndef THDB_PAGE_GUARD_H_
+#define THDB_PAGE_GUARD_H_
+
+#include <cstring>
+
+#include "defines.h"
+#include "macros.h"
+
+namespace thdb {
+
+/**
+ * @brief 只读页面守卫。
+ * 构造时固定页面一次，析构时解除固定，期间可以直接读取页面头和数据部分，
+ * 不再为每个字段单独调用MiniOS::ReadPage。
+ */
+class ReadPageGuard {
+ public:
+  explicit ReadPageGuard(PageID nPageID);
+  ~ReadPageGuard();
+  ReadPageGuard(const ReadPageGuard &) = delete;
+  ReadPageGuard &operator=(const ReadPageGuard &) = delete;
+
+  PageID GetPageID() const { return _nPageID; }
+  /**
+   * @brief 读出页面头部分nOffset处的一个定长值
+   */
+  template <class T>
+  T GetHeader(PageOffset nOffset) const {
+    T iValue;
+    memcpy(&iValue, _pPage + nOffset, sizeof(T));
+    return iValue;
+  }
+  const uint8_t *GetHeaderView() const { return _pPage; }
+  const uint8_t *GetDataView() const { return _pPage + HEADER_SIZE; }
+
+ private:
+  PageID _nPageID;
+  const uint8_t *_pPage;
+};
+
+/**
+ * @brief 可写页面守卫。
+ * 构造时固定页面一次，析构时解除固定；只有经由守卫修改过页面时才将其标记为脏页。
+ */
+class WritePageGuard {
+ public:
+  explicit WritePageGuard(PageID nPageID);
+  ~WritePageGuard();
+  WritePageGuard(const WritePageGuard &) = delete;
+  WritePageGuard &operator=(const WritePageGuard &) = delete;
+
+  PageID GetPageID() const { return _nPageID; }
+  template <class T>
+  T GetHeader(PageOffset nOffset) const {
+    T iValue;
+    memcpy(&iValue, _pPage + nOffset, sizeof(T));
+    return iValue;
+  }
+  /**
+   * @brief 写入页面头部分nOffset处的一个定长值
+   */
+  template <class T>
+  void SetHeader(PageOffset nOffset, const T &iValue) {
+    memcpy(_pPage + nOffset, &iValue, sizeof(T));
+    _bModified = true;
+  }
+  const uint8_t *GetHeaderView() const { return _pPage; }
+  const uint8_t *GetDataView() const { return _pPage + HEADER_SIZE; }
+  /**
+   * @brief 获得可修改的数据部分地址，调用后页面视为已修改
+   */
+  uint8_t *GetMutableData();
+  bool IsModified() const { return _bModified; }
+
+ private:
+  PageID _nPageID;
+  uint8_t *_pPage;
+  bool _bModified;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_PAGE_GUARD_H_
@@ -0,0 +1,178 @@
+#include "page/pax_page.h"
+
+#include <assert.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "exception/exceptions.h"
+#include "macros.h"
+#include "minios/os.h"
+
+namespace thdb {
+
+const PageOffset PAX_BITMAP_OFFSET = 0;
+const PageOffset PAX_ALIGN = 8;
+
+static PageOffset Align(Size nOffset) {
+  return (nOffset + PAX_ALIGN - 1) / PAX_ALIGN * PAX_ALIGN;
+}
+
+PaxPage::PaxPage(PageID nOwner, const std::vector<FieldType> &iTypeVec,
+                 const std::vector<Size> &iSizeVec, NewPageTag)
+    : LinkedPage(nOwner, NEW_PAGE),
+      _iTypeVec(iTypeVec),
+      _iSizeVec(iSizeVec),
+      _iView(iTypeVec, iSizeVec) {
+  Layout();
+  _bDirty = true;
+}
+
+PaxPage::PaxPage(PageID nPageID, const std::vector<FieldType> &iTypeVec,
+                 const std::vector<Size> &iSizeVec)
+    : LinkedPage(nPageID),
+      _iTypeVec(iTypeVec),
+      _iSizeVec(iSizeVec),
+      _iView(iTypeVec, iSizeVec) {
+  Layout();
+  _pUsed->Load(GetDataView() + PAX_BITMAP_OFFSET, _nBitmapSize);
+  _bDirty = false;
+}
+
+PaxPage::~PaxPage() {
+  if (_bDirty) {
+    std::vector<uint8_t> iTemp(_nBitmapSize, 0);
+    _pUsed->Store(iTemp.data());
+    SetData(iTemp.data(), _nBitmapSize, PAX_BITMAP_OFFSET);
+  }
+  delete _pUsed;
+}
+
+Size PaxPage::GetCapacity(const std::vector<Size> &iSizeVec) {
+  // 每个小页最多因对齐浪费PAX_ALIGN - 1字节，先扣除后再按每行1位位图计算容量
+  Size nDataSize = MiniOS::GetOS()->GetDataSize();
+  Size nRow = 0;
+  for (const auto &nSize : iSizeVec) nRow += nSize;
+  Size nAlign = PAX_ALIGN * (iSizeVec.size() + 1);
+  if (nDataSize <= nAlign) return 0;
+  Size nCap = (nRow == 0) ? nDataSize * 8
+                          : (nDataSize - nAlign) * 8 / (nRow * 8 + 1);
+  return (nCap > NULL_SLOT) ? NULL_SLOT : nCap;
+}
+
+void PaxPage::Layout() {
+  _nCap = GetCapacity(_iSizeVec);
+  assert(_nCap > 0);
+  _nBitmapSize = (_nCap + 7) / 8;
+  Size nOffset = Align(PAX_BITMAP_OFFSET + _nBitmapSize);
+  for (const auto &nSize : _iSizeVec) {
+    _iColumnVec.push_back(nOffset);
+    nOffset = Align(nOffset + nSize * _nCap);
+  }
+  assert(nOffset <= MiniOS::GetOS()->GetDataSize());
+  _pUsed = new Bitmap(_nCap);
+}
+
+Size PaxPage::GetCap() const { return _nCap; }
+
+Size PaxPage::GetUsed() const { return _pUsed->GetUsed(); }
+
+bool PaxPage::Full() const { return _pUsed->Full(); }
+
+PageOffset PaxPage::GetFreeSize() const {
+  Size nRow = 0;
+  for (const auto &nSize : _iSizeVec) nRow += nSize;
+  return (_nCap - GetUsed()) * nRow;
+}
+
+bool PaxPage::HasRecord(SlotID nSlotID) const {
+  return nSlotID < _nCap && _pUsed->Get(nSlotID);
+}
+
+void PaxPage::WriteRecord(SlotID nSlotID, const uint8_t *src) {
+  _iView.Reset(src);
+  std::vector<uint8_t> iValue;
+  for (FieldID i = 0; i < _iTypeVec.size(); ++i) {
+    Size nSize = _iSizeVec[i];
+    if (nSize == 0) continue;
+    iValue.assign(nSize, 0);
+    if (_iTypeVec[i] == FieldType::INT_TYPE) {
+      int nData = _iView.GetInt(i);
+      memcpy(iValue.data(), &nData, sizeof(int));
+    } else if (_iTypeVec[i] == FieldType::FLOAT_TYPE) {
+      double fData = _iView.GetFloat(i);
+      memcpy(iValue.data(), &fData, sizeof(double));
+    } else if (_iTypeVec[i] == FieldType::STRING_TYPE) {
+      StringView iData = _iView.GetStringView(i);
+      memcpy(iValue.data(), iData.GetData(),
+             std::min<Size>(iData.GetSize(), nSize));
+    }
+    SetData(iValue.data(), nSize, _iColumnVec[i] + nSize * nSlotID);
+  }
+}
+
+SlotID PaxPage::InsertRecord(const uint8_t *src) {
+  if (Full()) throw RecordPageException(_nCap);
+  SlotID nSlotID = _pUsed->FirstFree();
+  WriteRecord(nSlotID, src);
+  _pUsed->Set(nSlotID);
+  _bDirty = true;
+  return nSlotID;
+}
+
+Size PaxPage::GetRecord(SlotID nSlotID, std::vector<uint8_t> &iBuffer) const {
+  if (!HasRecord(nSlotID)) throw RecordPageException(nSlotID);
+  // 按VarStore格式重新拼出记录：字符串数量、各字符串长度、各列内容
+  const uint8_t *pData = GetDataView();
+  Size nBegin = iBuffer.size();
+  std::vector<PageOffset> iStrLen;
+  for (FieldID i = 0; i < _iTypeVec.size(); ++i) {
+    if (_iTypeVec[i] != FieldType::STRING_TYPE) continue;
+    const char *pStr =
+        (const char *)(pData + _iColumnVec[i] + _iSizeVec[i] * nSlotID);
+    iStrLen.push_back(strnlen(pStr, _iSizeVec[i]));
+  }
+  PageOffset nStrNum = iStrLen.size();
+  iBuffer.insert(iBuffer.end(), (const uint8_t *)&nStrNum,
+                 (const uint8_t *)&nStrNum + sizeof(PageOffset));
+  iBuffer.insert(iBuffer.end(), (const uint8_t *)iStrLen.data(),
+                 (const uint8_t *)(iStrLen.data() + nStrNum));
+  Size nStr = 0;
+  for (FieldID i = 0; i < _iTypeVec.size(); ++i) {
+    const uint8_t *pValue = pData + _iColumnVec[i] + _iSizeVec[i] * nSlotID;
+    Size nLen = _iSizeVec[i];
+    if (_iTypeVec[i] == FieldType::STRING_TYPE)
+      nLen = iStrLen[nStr++];
+    else if (_iTypeVec[i] == FieldType::NONE_TYPE)
+      nLen = 0;
+    iBuffer.insert(iBuffer.end(), pValue, pValue + nLen);
+  }
+  return iBuffer.size() - nBegin;
+}
+
+void PaxPage::DeleteRecord(SlotID nSlotID) {
+  if (!HasRecord(nSlotID)) throw RecordPageException(nSlotID);
+  _pUsed->Unset(nSlotID);
+  _bDirty = true;
+}
+
+void PaxPage::UpdateRecord(SlotID nSlotID, const uint8_t *src) {
+  if (!HasRecord(nSlotID)) throw RecordPageException(nSlotID);
+  WriteRecord(nSlotID, src);
+}
+
+void PaxPage::Scan(const RecordFilter *pFilter,
+                   std::vector<SlotID> &iSlotVec) const {
+  if (_pUsed->Empty()) return;
+  std::vector<uint8_t> iMatch(_nCap, 1);
+  if (pFilter) {
+    const uint8_t *pData = GetDataView();
+    std::vector<const uint8_t *> iColumns;
+    for (const auto &nOffset : _iColumnVec) iColumns.push_back(pData + nOffset);
+    pFilter->MatchColumns(iColumns, _nCap, iMatch.data());
+  }
+  for (SlotID i = 0; i < _nCap; ++i)
+    if (iMatch[i] && _pUsed->Get(i)) iSlotVec.push_back(i);
+}
+
+}  // namespace thdb
@@ -0,0 +1,109 @@
+#ifndef THDB_PAX_PAGE_H_
+#define THDB_PAX_PAGE_H_
+
+#include <vector>
+
+#include "field/field.h"
+#include "page/linked_page.h"
+#include "record/record_filter.h"
+#include "record/record_view.h"
+#include "utils/bitmap.h"
+
+namespace thdb {
+
+/**
+ * @brief PAX(Partition Attributes Across)布局的数据页面。
+ * 数据部分先存放槽占用位图，随后每列占用一个连续的小页，
+ * 第i个槽的第j列位于第j个小页的第i个位置。各列按表结构中的长度定长存放，
+ * 字符串按声明长度截断并以'\0'补齐。每个小页按8字节对齐。
+ * 页面不保存表结构，打开页面时由表提供各列的类型和长度。
+ * 记录的读写接口使用VariableRecord::VarStore格式，与ToastPage一致。
+ */
+class PaxPage : public LinkedPage {
+ public:
+  /**
+   * @brief 在nOwner的区段中构建一个新的PAX页面
+   * @param nOwner 所属表的页面编号
+   */
+  PaxPage(PageID nOwner, const std::vector<FieldType> &iTypeVec,
+          const std::vector<Size> &iSizeVec, NewPageTag);
+  /**
+   * @brief 从MiniOS中重新导入一个PAX页面
+   * @param nPageID 页面编号
+   */
+  PaxPage(PageID nPageID, const std::vector<FieldType> &iTypeVec,
+          const std::vector<Size> &iSizeVec);
+  ~PaxPage();
+
+  /**
+   * @brief 插入一条记录，各列写入对应的小页
+   *
+   * @param src VariableRecord::VarStore格式的记录
+   * @return SlotID 插入位置的槽编号
+   */
+  SlotID InsertRecord(const uint8_t *src);
+  /**
+   * @brief 从各列小页中取出一条记录
+   *
+   * @param iBuffer 记录以VariableRecord::VarStore格式追加到末尾
+   * @return Size 记录的长度
+   */
+  Size GetRecord(SlotID nSlotID, std::vector<uint8_t> &iBuffer) const;
+  bool HasRecord(SlotID nSlotID) const;
+  void DeleteRecord(SlotID nSlotID);
+  /**
+   * @brief 原地更新一条记录，槽编号保持不变
+   */
+  void UpdateRecord(SlotID nSlotID, const uint8_t *src);
+  /**
+   * @brief 在各列小页上按列求值过滤器，收集满足条件的槽编号。
+   * 只读取条件涉及的列。
+   *
+   * @param pFilter 过滤器，为nullptr时收集全部记录
+   * @param iSlotVec 满足条件的槽编号，按槽编号升序追加
+   */
+  void Scan(const RecordFilter *pFilter, std::vector<SlotID> &iSlotVec) const;
+
+  /**
+   * @brief 计算各列长度为iSizeVec时一个PAX页面能容纳的槽数量
+   * @return Size 为0时一行过宽，该表结构不能使用PAX布局
+   */
+  static Size GetCapacity(const std::vector<Size> &iSizeVec);
+
+  Size GetCap() const;
+  Size GetUsed() const;
+  bool Full() const;
+  /**
+   * @brief 获得剩余空间，按空闲槽数量乘以一行各列的总长度计算
+   */
+  PageOffset GetFreeSize() const;
+
+ private:
+  /**
+   * @brief 根据页面大小和各列长度确定页面容量与各小页的位置
+   */
+  void Layout();
+  /**
+   * @brief 将一条VarStore格式的记录写入第nSlotID个位置
+   */
+  void WriteRecord(SlotID nSlotID, const uint8_t *src);
+
+  std::vector<FieldType> _iTypeVec;
+  std::vector<Size> _iSizeVec;
+  /**
+   * @brief 各列小页在数据部分的起始位置
+   */
+  std::vector<PageOffset> _iColumnVec;
+  Size _nCap;
+  PageOffset _nBitmapSize;
+  Bitmap *_pUsed;
+  bool _bDirty;
+  /**
+   * @brief 解析待写入记录的视图
+   */
+  RecordView _iView;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_PAX_PAGE_H_
@@ -1,46 +1,68 @@
-#include "record_page.h"
+#include "page/record_page.h"
 
 #include <assert.h>
 
+#include <algorithm>
 #include <cstring>
+#include <vector>
 
 #include "exception/exceptions.h"
 #include "macros.h"
+#include "minios/os.h"
 
 namespace thdb {
 
 const PageOffset FIXED_SIZE_OFFSET = 12;
 const PageOffset BITMAP_OFFSET = 0;
-const PageOffset BITMAP_SIZE = 128;
+const PageOffset MIN_BITMAP_SIZE = 128;
 
-RecordPage::RecordPage(PageOffset nFixed, bool) : LinkedPage() {
+RecordPage::RecordPage(PageOffset nFixed, NewPageTag) : LinkedPage() {
   _nFixed = nFixed;
-  _pUsed = new Bitmap((DATA_SIZE - BITMAP_SIZE) / nFixed);
-  _nCap = (DATA_SIZE - BITMAP_SIZE) / _nFixed;
   SetHeader((uint8_t *)&_nFixed, 2, FIXED_SIZE_OFFSET);
+  Layout();
+  _bDirty = true;
+}
+
+RecordPage::RecordPage(PageID nOwner, PageOffset nFixed, NewPageTag)
+    : LinkedPage(nOwner, NEW_PAGE) {
+  _nFixed = nFixed;
+  SetHeader((uint8_t *)&_nFixed, 2, FIXED_SIZE_OFFSET);
+  Layout();
+  _bDirty = true;
 }
 
 RecordPage::RecordPage(PageID nPageID) : LinkedPage(nPageID) {
   GetHeader((uint8_t *)&_nFixed, 2, FIXED_SIZE_OFFSET);
-  _pUsed = new Bitmap((DATA_SIZE - BITMAP_SIZE) / _nFixed);
-  _nCap = (DATA_SIZE - BITMAP_SIZE) / _nFixed;
+  Layout();
   LoadBitmap();
+  _bDirty = false;
 }
 
-RecordPage::~RecordPage() { StoreBitmap(); }
+RecordPage::~RecordPage() {
+  // 只读打开的页面不写回位图，扫描不会把页面标记为已修改
+  if (_bDirty) StoreBitmap();
+  delete _pUsed;
+}
+
+void RecordPage::Layout() {
+  // 位图至少占用MIN_BITMAP_SIZE字节，页面较大时按每条记录1位扩展，
+  // 4096字节页面上的布局与固定位图时完全一致
+  Size nDataSize = MiniOS::GetOS()->GetDataSize();
+  Size nMaxCap = nDataSize * 8 / (_nFixed * 8 + 1);
+  _nBitmapSize = std::max<Size>(MIN_BITMAP_SIZE, (nMaxCap + 7) / 8);
+  _nCap = std::min<Size>((nDataSize - _nBitmapSize) / _nFixed,
+                         _nBitmapSize * 8);
+  _pUsed = new Bitmap(_nCap);
+}
 
 void RecordPage::LoadBitmap() {
-  uint8_t pTemp[BITMAP_SIZE];
-  memset(pTemp, 0, BITMAP_SIZE);
-  GetData(pTemp, BITMAP_SIZE, BITMAP_OFFSET);
-  _pUsed->Load(pTemp);
+  _pUsed->Load(GetDataView() + BITMAP_OFFSET);
 }
 
 void RecordPage::StoreBitmap() {
-  uint8_t pTemp[BITMAP_SIZE];
-  memset(pTemp, 0, BITMAP_SIZE);
-  _pUsed->Store(pTemp);
-  SetData(pTemp, BITMAP_SIZE, BITMAP_OFFSET);
+  std::vector<uint8_t> iTemp(_nBitmapSize, 0);
+  _pUsed->Store(iTemp.data());
+  SetData(iTemp.data(), _nBitmapSize, BITMAP_OFFSET);
 }
 
 Size RecordPage::GetCap() const { return _nCap; }
@@ -54,6 +76,10 @@ void RecordPage::Clear() {
     if (HasRecord(i)) DeleteRecord(i);
 }
 
+PageOffset RecordPage::GetFreeSize() const {
+  return (_nCap - GetUsed()) * _nFixed;
+}
+
 SlotID RecordPage::InsertRecord(const uint8_t *src) {
   // LAB1 BEGIN
   // TODO: 寻找空的槽位，插入数据
@@ -62,12 +88,10 @@ SlotID RecordPage::InsertRecord(const uint8_t *src) {
   // TIPS: 使用SetData实现写数据
   // LAB1 END
   if (Full()) throw RecordPageException(_nCap);
-  SlotID empty = 0;
-  while (HasRecord(empty)) {
-    empty += 1;
-  }
-  SetData(src, _nFixed, BITMAP_OFFSET + BITMAP_SIZE + empty * _nFixed);
+  SlotID empty = _pUsed->FirstFree();
+  SetData(src, _nFixed, BITMAP_OFFSET + _nBitmapSize + empty * _nFixed);
   _pUsed->Set(empty);
+  _bDirty = true;
   return empty;
 }
 
@@ -79,11 +103,18 @@ uint8_t *RecordPage::GetRecord(SlotID nSlotID) {
   // LAB1 END
   if (!HasRecord(nSlotID)) throw RecordPageException(nSlotID);
   uint8_t *data = new uint8_t[_nFixed];
-  GetData(data, _nFixed, BITMAP_OFFSET + BITMAP_SIZE + nSlotID * _nFixed);
+  GetData(data, _nFixed, BITMAP_OFFSET + _nBitmapSize + nSlotID * _nFixed);
   return data;
 }
 
-bool RecordPage::HasRecord(SlotID nSlotID) { return _pUsed->Get(nSlotID); }
+const uint8_t *RecordPage::ViewRecord(SlotID nSlotID) const {
+  if (!HasRecord(nSlotID)) throw RecordPageException(nSlotID);
+  return GetDataView() + BITMAP_OFFSET + _nBitmapSize + nSlotID * _nFixed;
+}
+
+bool RecordPage::HasRecord(SlotID nSlotID) const {
+  return nSlotID < _nCap && _pUsed->Get(nSlotID);
+}
 
 void RecordPage::DeleteRecord(SlotID nSlotID) {
   // LAB1 BEGIN
@@ -92,11 +123,24 @@ void RecordPage::DeleteRecord(SlotID nSlotID) {
   // LAB1 END
   if (!HasRecord(nSlotID)) throw RecordPageException(nSlotID);
   _pUsed->Unset(nSlotID);
+  _bDirty = true;
 }
 
 void RecordPage::UpdateRecord(SlotID nSlotID, const uint8_t *src) {
-  if (!_pUsed->Get(nSlotID)) throw RecordPageException(nSlotID);
-  SetData(src, _nFixed, BITMAP_OFFSET + BITMAP_SIZE + nSlotID * _nFixed);
+  if (!HasRecord(nSlotID)) throw RecordPageException(nSlotID);
+  SetData(src, _nFixed, BITMAP_OFFSET + _nBitmapSize + nSlotID * _nFixed);
+}
+
+void RecordPage::Scan(const RecordFilter *pFilter,
+                      std::vector<SlotID> &iSlotVec) const {
+  if (_pUsed->Empty()) return;
+  // 槽位置由槽编号直接算出，逐个检查位图并在页面字节上求值
+  const uint8_t *pData = GetDataView() + BITMAP_OFFSET + _nBitmapSize;
+  for (SlotID i = 0; i < _nCap; ++i, pData += _nFixed) {
+    if (!_pUsed->Get(i)) continue;
+    if (pFilter && !pFilter->Match(pData)) continue;
+    iSlotVec.push_back(i);
+  }
 }
 
 }  // namespace thdb
@@ -1,14 +1,18 @@
 #ifndef THDB_RECORD_PAGE_H_
 #define THDB_RECORD_PAGE_H_
 
+#include <vector>
+
 #include "page/linked_page.h"
+#include "record/record_filter.h"
 #include "utils/bitmap.h"
 
 namespace thdb {
 
 /**
  * @brief 定长记录页面。
- *
+ * 数据部分先存放槽占用位图，随后按槽编号连续存放定长记录，
+ * 第i个槽位于位图之后的第i * nFixed字节，不需要槽目录。
  */
 class RecordPage : public LinkedPage {
  public:
@@ -16,7 +20,13 @@ class RecordPage : public LinkedPage {
    * @brief 构建一个新的定长记录页面
    * @param nFixed 定长记录长度
    */
-  RecordPage(PageOffset nFixed, bool);
+  RecordPage(PageOffset nFixed, NewPageTag);
+  /**
+   * @brief 在nOwner的区段中构建一个新的定长记录页面
+   * @param nOwner 所属表的页面编号
+   * @param nFixed 定长记录长度
+   */
+  RecordPage(PageID nOwner, PageOffset nFixed, NewPageTag);
   /**
    * @brief 从MiniOS中重新导入一个定长记录页面
    * @param nPageID 页面编号
@@ -38,6 +48,11 @@ class RecordPage : public LinkedPage {
    * @return uint8_t* 记录定长格式化的内容
    */
   uint8_t *GetRecord(SlotID nSlotID);
+  /**
+   * @brief 获得指定位置记录在页面中的只读视图，不复制数据，
+   * 视图在页面对象析构前有效
+   */
+  const uint8_t *ViewRecord(SlotID nSlotID) const;
   /**
    * @brief 判断某一个槽是否存在记录
    *
@@ -45,7 +60,7 @@ class RecordPage : public LinkedPage {
    * @return true 存在记录
    * @return false 不存在记录
    */
-  bool HasRecord(SlotID nSlotID);
+  bool HasRecord(SlotID nSlotID) const;
   /**
    * @brief 删除指定位置的记录
    *
@@ -59,15 +74,30 @@ class RecordPage : public LinkedPage {
    * @param src 新的定长格式化内容
    */
   void UpdateRecord(SlotID nSlotID, const uint8_t *src);
+  /**
+   * @brief 在页面字节上求值过滤器，收集满足条件的槽编号
+   *
+   * @param pFilter 过滤器，为nullptr时收集全部记录
+   * @param iSlotVec 满足条件的槽编号，按槽编号升序追加
+   */
+  void Scan(const RecordFilter *pFilter, std::vector<SlotID> &iSlotVec) const;
 
   Size GetCap() const;
   Size GetUsed() const;
   bool Full() const;
   void Clear();
+  /**
+   * @brief 获得剩余空间，按空闲槽数量乘以定长记录长度计算
+   */
+  PageOffset GetFreeSize() const;
 
  private:
   void StoreBitmap();
   void LoadBitmap();
+  /**
+   * @brief 根据页面大小和定长记录长度确定位图长度和页面容量
+   */
+  void Layout();
 
   /**
    * @brief 表示支持的定长记录长度
@@ -77,10 +107,18 @@ class RecordPage : public LinkedPage {
    * @brief 表示页面能容纳的记录数量
    */
   Size _nCap;
+  /**
+   * @brief 表示位图占用的字节数
+   */
+  PageOffset _nBitmapSize;
   /**
    * @brief 表示槽占用状况的位图
    */
   Bitmap *_pUsed;
+  /**
+   * @brief 位图是否被修改，只有修改过的位图才在析构时写回
+   */
+  bool _bDirty;
 };
 
 }  // namespace thdb
@@ -0,0 +1,77 @@
+#include "page/summary_page.h"
+
+#include <cstring>
+
+#include "exception/exceptions.h"
+#include "macros.h"
+#include "minios/os.h"
+#include "page/page_guard.h"
+
+namespace thdb {
+
+const PageOffset SUMMARY_USED_ENTRIES_OFFSET = 12;
+
+SummaryPage::SummaryPage(PageID nOwner, Size nEntrySize, NewPageTag)
+    : LinkedPage(nOwner, NEW_PAGE), _nEntrySize(nEntrySize) {
+  _bDirty = true;
+}
+
+SummaryPage::SummaryPage(PageID nPageID, Size nEntrySize)
+    : LinkedPage(nPageID), _nEntrySize(nEntrySize) {
+  _bDirty = false;
+  ReadPageGuard iGuard(nPageID);
+  SlotID nUsed = iGuard.GetHeader<SlotID>(SUMMARY_USED_ENTRIES_OFFSET);
+  _iHeapVec.resize(nUsed);
+  _iEntryVec.resize(_nEntrySize * nUsed);
+  memcpy(_iEntryVec.data(), iGuard.GetDataView(), _nEntrySize * nUsed);
+  memcpy(_iHeapVec.data(),
+         iGuard.GetDataView() + _nEntrySize * GetCap(_nEntrySize),
+         sizeof(PageID) * nUsed);
+}
+
+SummaryPage::~SummaryPage() {
+  if (!_bDirty) return;
+  WritePageGuard iGuard(_nPageID);
+  SlotID nUsed = _iHeapVec.size();
+  iGuard.SetHeader(SUMMARY_USED_ENTRIES_OFFSET, nUsed);
+  uint8_t *pData = iGuard.GetMutableData();
+  memcpy(pData, _iEntryVec.data(), _nEntrySize * nUsed);
+  memcpy(pData + _nEntrySize * GetCap(_nEntrySize), _iHeapVec.data(),
+         sizeof(PageID) * nUsed);
+}
+
+Size SummaryPage::GetCap(Size nEntrySize) {
+  return MiniOS::GetOS()->GetDataSize() / (sizeof(PageID) + nEntrySize);
+}
+
+SlotID SummaryPage::Append(PageID nHeapID, const uint8_t *pEntry) {
+  if (Full()) throw ToastPageFullException();
+  _bDirty = true;
+  _iHeapVec.push_back(nHeapID);
+  _iEntryVec.insert(_iEntryVec.end(), pEntry, pEntry + _nEntrySize);
+  return _iHeapVec.size() - 1;
+}
+
+void SummaryPage::SetEntry(SlotID nSlotID, const uint8_t *pEntry) {
+  if (nSlotID >= _iHeapVec.size()) throw RecordPageException(nSlotID);
+  _bDirty = true;
+  memcpy(_iEntryVec.data() + _nEntrySize * nSlotID, pEntry, _nEntrySize);
+}
+
+PageID SummaryPage::GetHeapID(SlotID nSlotID) const {
+  if (nSlotID >= _iHeapVec.size()) throw RecordPageException(nSlotID);
+  return _iHeapVec[nSlotID];
+}
+
+const uint8_t *SummaryPage::GetEntry(SlotID nSlotID) const {
+  if (nSlotID >= _iHeapVec.size()) throw RecordPageException(nSlotID);
+  return _iEntryVec.data() + _nEntrySize * nSlotID;
+}
+
+Size SummaryPage::GetUsed() const { return _iHeapVec.size(); }
+
+bool SummaryPage::Full() const {
+  return _iHeapVec.size() >= GetCap(_nEntrySize);
+}
+
+}  // namespace thdb
@@ -0,0 +1,61 @@
+#ifndef THDB_SUMMARY_PAGE_H_
+#define THDB_SUMMARY_PAGE_H_
+
+#include <vector>
+
+#include "page/linked_page.h"
+
+namespace thdb {
+
+/**
+ * @brief 数据页面摘要页面。
+ * 按表页面链表的顺序记录若干数据页面的编号和定长的摘要，
+ * 摘要的内容由使用者解释，例如区域映射的取值范围或布隆过滤器的位数组。
+ * 数据部分先存放摘要数组，再存放页面编号数组。
+ */
+class SummaryPage : public LinkedPage {
+ public:
+  /**
+   * @brief 在nOwner的区段中构建一个新的摘要页面
+   * @param nOwner 所属表的页面编号
+   * @param nEntrySize 每个数据页面摘要的字节数
+   */
+  SummaryPage(PageID nOwner, Size nEntrySize, NewPageTag);
+  /**
+   * @brief 从MiniOS中重新导入一个摘要页面
+   * @param nPageID 页面编号
+   * @param nEntrySize 每个数据页面摘要的字节数
+   */
+  SummaryPage(PageID nPageID, Size nEntrySize);
+  ~SummaryPage();
+
+  /**
+   * @brief 追加一个数据页面的记录
+   *
+   * @param nHeapID 数据页面编号
+   * @param pEntry 摘要内容，共nEntrySize字节
+   * @return SlotID 记录所在位置
+   */
+  SlotID Append(PageID nHeapID, const uint8_t *pEntry);
+  void SetEntry(SlotID nSlotID, const uint8_t *pEntry);
+
+  PageID GetHeapID(SlotID nSlotID) const;
+  const uint8_t *GetEntry(SlotID nSlotID) const;
+  Size GetUsed() const;
+  bool Full() const;
+
+  /**
+   * @brief 获得当前页面大小下每个页面能记录的数据页面数量
+   */
+  static Size GetCap(Size nEntrySize);
+
+ private:
+  Size _nEntrySize;
+  std::vector<PageID> _iHeapVec;
+  std::vector<uint8_t> _iEntryVec;
+  bool _bDirty;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_SUMMARY_PAGE_H_
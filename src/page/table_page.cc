@@ -3,9 +3,13 @@
 #include <assert.h>
 
 #include <algorithm>
+#include <cstring>
 
 #include "exception/exceptions.h"
+#include "page/page_guard.h"
+#include "page/pax_page.h"
 #include "page/record_page.h"
+#include "page/toast_page.h"
 
 namespace thdb {
 
@@ -13,6 +17,13 @@ const PageOffset COLUMN_LEN_OFFSET = 16;
 const PageOffset COLUMN_NAME_LEN_OFFSET = 20;
 const PageOffset HEAD_PAGE_OFFSET = 24;
 const PageOffset TAIL_PAGE_OFFSET = 28;
+const PageOffset FREE_SPACE_PAGE_OFFSET = 32;
+const PageOffset LAYOUT_OFFSET = 36;
+const PageOffset ZONE_MAP_PAGE_OFFSET = 40;
+const PageOffset BLOOM_FILTER_PAGE_OFFSET = 44;
+const PageOffset BLOOM_COLUMNS_OFFSET = 48;
+const PageOffset DELETED_COUNT_OFFSET = 56;
+const PageOffset SUMMARY_STALE_OFFSET = 60;
 
 const PageOffset COLUMN_TYPE_OFFSET = 0;
 const PageOffset COLUMN_SIZE_OFFSET = 64;
@@ -26,8 +37,26 @@ TablePage::TablePage(const Schema &iSchema) : Page() {
     _iSizeVec.push_back(iCol.GetSize());
   }
   assert(_iColMap.size() == _iTypeVec.size());
-  RecordPage *pPage = new RecordPage(GetTotalSize(), true);
+  _iLayout = iSchema.GetLayout();
+  // 所有列均为定长数值列时，记录长度固定，按行布局改用定长记录页面
+  bool bFixed = !_iTypeVec.empty();
+  for (const auto &iType : _iTypeVec)
+    if (iType != FieldType::INT_TYPE && iType != FieldType::FLOAT_TYPE)
+      bFixed = false;
+  if (_iLayout == TableLayout::ROW && bFixed) _iLayout = TableLayout::FIXED;
+  LinkedPage *pPage = nullptr;
+  if (_iLayout == TableLayout::COLUMNAR)
+    pPage = new PaxPage(GetPageID(), _iTypeVec, _iSizeVec, NEW_PAGE);
+  else if (_iLayout == TableLayout::FIXED)
+    pPage = new RecordPage(GetPageID(), GetFixedSize(), NEW_PAGE);
+  else
+    pPage = new ToastPage(GetPageID(), NEW_PAGE);
   _nHeadID = _nTailID = pPage->GetPageID();
+  _nFreeSpaceID = 0;
+  _nZoneMapID = 0;
+  _nBloomFilterID = 0;
+  _nDeleted = 0;
+  _bSummaryStale = false;
   delete pPage;
   _bModified = true;
 }
@@ -58,6 +87,12 @@ Size TablePage::GetTotalSize() const {
   return nTotal;
 }
 
+Size TablePage::GetFixedSize() const {
+  return sizeof(PageOffset) + GetTotalSize();
+}
+
+TableLayout TablePage::GetLayout() const { return _iLayout; }
+
 PageID TablePage::GetHeadID() const { return _nHeadID; }
 
 PageID TablePage::GetTailID() const { return _nTailID; }
@@ -72,6 +107,50 @@ void TablePage::SetTailID(PageID nTailID) {
   _bModified = true;
 }
 
+PageID TablePage::GetFreeSpaceID() const { return _nFreeSpaceID; }
+
+void TablePage::SetFreeSpaceID(PageID nFreeSpaceID) {
+  _nFreeSpaceID = nFreeSpaceID;
+  _bModified = true;
+}
+
+PageID TablePage::GetZoneMapID() const { return _nZoneMapID; }
+
+void TablePage::SetZoneMapID(PageID nZoneMapID) {
+  _nZoneMapID = nZoneMapID;
+  _bModified = true;
+}
+
+PageID TablePage::GetBloomFilterID() const { return _nBloomFilterID; }
+
+void TablePage::SetBloomFilterID(PageID nBloomFilterID) {
+  _nBloomFilterID = nBloomFilterID;
+  _bModified = true;
+}
+
+std::vector<FieldID> TablePage::GetBloomColumns() const {
+  return _iBloomColVec;
+}
+
+void TablePage::SetBloomColumns(const std::vector<FieldID> &iColVec) {
+  _iBloomColVec = iColVec;
+  _bModified = true;
+}
+
+Size TablePage::GetDeletedCount() const { return _nDeleted; }
+
+void TablePage::SetDeletedCount(Size nDeleted) {
+  _nDeleted = nDeleted;
+  _bModified = true;
+}
+
+bool TablePage::IsSummaryStale() const { return _bSummaryStale; }
+
+void TablePage::SetSummaryStale(bool bStale) {
+  _bSummaryStale = bStale;
+  _bModified = true;
+}
+
 bool CmpByValue(const std::pair<String, FieldID> &a,
                 const std::pair<String, FieldID> &b) {
   return a.second < b.second;
@@ -105,47 +184,60 @@ std::map<String, FieldID> LoadColumnsString(const String &sName) {
 }
 
 void TablePage::Store() {
-  SetHeader((uint8_t *)&_nHeadID, 4, HEAD_PAGE_OFFSET);
-  SetHeader((uint8_t *)&_nTailID, 4, TAIL_PAGE_OFFSET);
+  WritePageGuard iGuard(_nPageID);
+  uint8_t *pData = iGuard.GetMutableData();
+  iGuard.SetHeader(HEAD_PAGE_OFFSET, _nHeadID);
+  iGuard.SetHeader(TAIL_PAGE_OFFSET, _nTailID);
+  iGuard.SetHeader(FREE_SPACE_PAGE_OFFSET, _nFreeSpaceID);
+  iGuard.SetHeader(LAYOUT_OFFSET, (uint32_t)_iLayout);
+  iGuard.SetHeader(ZONE_MAP_PAGE_OFFSET, _nZoneMapID);
+  iGuard.SetHeader(BLOOM_FILTER_PAGE_OFFSET, _nBloomFilterID);
+  uint64_t nBloomColumns = 0;
+  for (const auto &nPos : _iBloomColVec) nBloomColumns |= 1ULL << nPos;
+  iGuard.SetHeader(BLOOM_COLUMNS_OFFSET, nBloomColumns);
+  iGuard.SetHeader(DELETED_COUNT_OFFSET, _nDeleted);
+  iGuard.SetHeader(SUMMARY_STALE_OFFSET, (uint32_t)_bSummaryStale);
   FieldID iFieldSize = _iSizeVec.size();
-  SetHeader((uint8_t *)&iFieldSize, 4, COLUMN_LEN_OFFSET);
+  iGuard.SetHeader(COLUMN_LEN_OFFSET, iFieldSize);
   for (Size i = 0; i < iFieldSize; ++i) {
-    int nType = (int)_iTypeVec[i];
-    SetData((uint8_t *)&nType, 1, COLUMN_TYPE_OFFSET + i);
+    pData[COLUMN_TYPE_OFFSET + i] = (uint8_t)_iTypeVec[i];
   }
   for (Size i = 0; i < iFieldSize; ++i) {
-    Size nSize = _iSizeVec[i];
-    SetData((uint8_t *)&nSize, 2, COLUMN_SIZE_OFFSET + 2 * i);
+    uint16_t nSize = _iSizeVec[i];
+    memcpy(pData + COLUMN_SIZE_OFFSET + 2 * i, &nSize, 2);
   }
   String sColumnsName = BuildColumnsString(_iColMap);
   Size sColNameLen = sColumnsName.size();
-  SetHeader((uint8_t *)&sColNameLen, 4, COLUMN_NAME_LEN_OFFSET);
-  SetData((uint8_t *)sColumnsName.c_str(), sColNameLen, COLUMN_NAME_OFFSET);
+  iGuard.SetHeader(COLUMN_NAME_LEN_OFFSET, sColNameLen);
+  memcpy(pData + COLUMN_NAME_OFFSET, sColumnsName.c_str(), sColNameLen);
 }
 
 void TablePage::Load() {
-  GetHeader((uint8_t *)&_nHeadID, 4, HEAD_PAGE_OFFSET);
-  GetHeader((uint8_t *)&_nTailID, 4, TAIL_PAGE_OFFSET);
-  FieldID iFieldSize = 0;
-  GetHeader((uint8_t *)&iFieldSize, 4, COLUMN_LEN_OFFSET);
+  ReadPageGuard iGuard(_nPageID);
+  const uint8_t *pData = iGuard.GetDataView();
+  _nHeadID = iGuard.GetHeader<PageID>(HEAD_PAGE_OFFSET);
+  _nTailID = iGuard.GetHeader<PageID>(TAIL_PAGE_OFFSET);
+  _nFreeSpaceID = iGuard.GetHeader<PageID>(FREE_SPACE_PAGE_OFFSET);
+  _iLayout = TableLayout(iGuard.GetHeader<uint32_t>(LAYOUT_OFFSET));
+  _nZoneMapID = iGuard.GetHeader<PageID>(ZONE_MAP_PAGE_OFFSET);
+  _nBloomFilterID = iGuard.GetHeader<PageID>(BLOOM_FILTER_PAGE_OFFSET);
+  uint64_t nBloomColumns = iGuard.GetHeader<uint64_t>(BLOOM_COLUMNS_OFFSET);
+  for (FieldID i = 0; i < 64; ++i)
+    if (nBloomColumns & (1ULL << i)) _iBloomColVec.push_back(i);
+  _nDeleted = iGuard.GetHeader<Size>(DELETED_COUNT_OFFSET);
+  _bSummaryStale = iGuard.GetHeader<uint32_t>(SUMMARY_STALE_OFFSET) != 0;
+  FieldID iFieldSize = iGuard.GetHeader<FieldID>(COLUMN_LEN_OFFSET);
   for (Size i = 0; i < iFieldSize; ++i) {
-    int nType = 0;
-    GetData((uint8_t *)&nType, 1, COLUMN_TYPE_OFFSET + i);
-    _iTypeVec.push_back(FieldType(nType));
+    _iTypeVec.push_back(FieldType(pData[COLUMN_TYPE_OFFSET + i]));
   }
   for (Size i = 0; i < iFieldSize; ++i) {
-    Size nSize = 0;
-    GetData((uint8_t *)&nSize, 2, COLUMN_SIZE_OFFSET + 2 * i);
+    uint16_t nSize = 0;
+    memcpy(&nSize, pData + COLUMN_SIZE_OFFSET + 2 * i, 2);
     _iSizeVec.push_back(nSize);
   }
-  Size sColNameLen = 0;
-  GetHeader((uint8_t *)&sColNameLen, 4, COLUMN_NAME_LEN_OFFSET);
-  char *pTemp = new char[sColNameLen + 1];
-  pTemp[sColNameLen] = '\0';
-  GetData((uint8_t *)pTemp, sColNameLen, COLUMN_NAME_OFFSET);
-  String sName{pTemp};
+  Size sColNameLen = iGuard.GetHeader<Size>(COLUMN_NAME_LEN_OFFSET);
+  String sName((const char *)pData + COLUMN_NAME_OFFSET, sColNameLen);
   _iColMap = LoadColumnsString(sName);
-  delete[] pTemp;
 }
 
 FieldID TablePage::GetPos(const String &sCol) { return _iColMap[sCol]; }
@@ -21,11 +21,49 @@ class TablePage : public Page {
   std::vector<FieldType> GetTypeVec() const;
   std::vector<Size> GetSizeVec() const;
   Size GetTotalSize() const;
+  /**
+   * @brief 获得定长布局下一条记录的长度，即VarStore格式的记录长度
+   */
+  Size GetFixedSize() const;
+  /**
+   * @brief 获得数据页面布局，旧版本的表均为按行布局
+   */
+  TableLayout GetLayout() const;
 
   PageID GetHeadID() const;
   PageID GetTailID() const;
   void SetHeadID(PageID nHeadID);
   void SetTailID(PageID nTailID);
+  /**
+   * @brief 获得空闲空间映射第一个页面的编号，旧版本的表尚未建立映射时返回0
+   */
+  PageID GetFreeSpaceID() const;
+  void SetFreeSpaceID(PageID nFreeSpaceID);
+  /**
+   * @brief 获得区域映射第一个页面的编号，尚未建立映射时返回0
+   */
+  PageID GetZoneMapID() const;
+  void SetZoneMapID(PageID nZoneMapID);
+  /**
+   * @brief 获得布隆过滤器第一个页面的编号，没有过滤器时返回0
+   */
+  PageID GetBloomFilterID() const;
+  void SetBloomFilterID(PageID nBloomFilterID);
+  /**
+   * @brief 获得建立了布隆过滤器的列，按列编号升序排列
+   */
+  std::vector<FieldID> GetBloomColumns() const;
+  void SetBloomColumns(const std::vector<FieldID> &iColVec);
+  /**
+   * @brief 获得上次整理以来删除的记录数量，旧版本的表从0开始计数
+   */
+  Size GetDeletedCount() const;
+  void SetDeletedCount(Size nDeleted);
+  /**
+   * @brief 区域映射和布隆过滤器是否可能落后于数据页面，为真时打开表需重新构建
+   */
+  bool IsSummaryStale() const;
+  void SetSummaryStale(bool bStale);
 
   FieldID GetPos(const String &sCol);
   FieldType GetType(const String &sCol);
@@ -39,6 +77,13 @@ class TablePage : public Page {
   std::vector<FieldType> _iTypeVec;
   std::vector<Size> _iSizeVec;
   PageID _nHeadID, _nTailID;
+  PageID _nFreeSpaceID;
+  PageID _nZoneMapID;
+  PageID _nBloomFilterID;
+  std::vector<FieldID> _iBloomColVec;
+  Size _nDeleted;
+  bool _bSummaryStale;
+  TableLayout _iLayout;
   bool _bModified = false;
 
   friend class Table;
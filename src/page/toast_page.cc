@@ -7,6 +7,10 @@
 
 #include "exception/exceptions.h"
 #include "macros.h"
+#include "minios/os.h"
+#include "page/decoded_cache.h"
+#include "page/page_guard.h"
+#include "settings.h"
 
 namespace thdb {
 const PageOffset USED_SLOTS_OFFSET = 12;
@@ -15,87 +19,236 @@ const PageOffset SPEAR_LOWER_OFFSET = 20;
 const PageOffset SPEAR_UPPER_OFFSET = 24;
 
 ToastPage::ToastPage() : LinkedPage() {
+  _bDirty = true;
   _usedSlots = 0;
+  _nFreeSlot = NULL_SLOT;
+  _nGarbage = 0;
   spareLower = 0;
-  spareUpper = DATA_SIZE;
-}
-
-ToastPage::ToastPage(PageID nPageID) : LinkedPage(nPageID) {
-  SlotID slots_num = 0;
-  GetHeader((uint8_t *)&_usedSlots, sizeof(SlotID), USED_SLOTS_OFFSET);
-  GetHeader((uint8_t *)&slots_num, sizeof(SlotID), SLOTS_NUM);
-  GetHeader((uint8_t *)&spareLower, sizeof(PageOffset), SPEAR_LOWER_OFFSET);
-  GetHeader((uint8_t *)&spareUpper, sizeof(PageOffset), SPEAR_UPPER_OFFSET);
-  if (slots_num == 0) {
-    _usedSlots = 0;
-    spareLower = 0;
-    spareUpper = DATA_SIZE;
-    return;
+  spareUpper = MiniOS::GetOS()->GetDataSize();
+}
+
+ToastPage::ToastPage(PageID nOwner, NewPageTag) : LinkedPage(nOwner, NEW_PAGE) {
+  _bDirty = true;
+  _usedSlots = 0;
+  _nFreeSlot = NULL_SLOT;
+  _nGarbage = 0;
+  spareLower = 0;
+  spareUpper = MiniOS::GetOS()->GetDataSize();
+}
+
+/**
+ * @brief 变长记录页面的槽目录解码结果，由缓存和各个ToastPage对象共享
+ */
+struct ToastDirectory {
+  PageID nNextID;
+  PageID nPrevID;
+  SlotID nUsedSlots;
+  PageOffset nSpareLower;
+  PageOffset nSpareUpper;
+  SlotID nFreeSlot;
+  PageOffset nGarbage;
+  std::vector<ToastPage::Slot_t> iSlots;
+};
+
+DecodedCache<ToastDirectory> &DirectoryCache() {
+  static DecodedCache<ToastDirectory> iCache(DECODED_CACHE_PAGES);
+  return iCache;
+}
+
+ToastPage::ToastPage(PageID nPageID)
+    : ToastPage(nPageID, LoadDirectory(nPageID)) {}
+
+ToastPage::ToastPage(PageID nPageID,
+                     std::shared_ptr<const ToastDirectory> pDirectory)
+    : LinkedPage(nPageID, pDirectory->nNextID, pDirectory->nPrevID) {
+  _bDirty = false;
+  _usedSlots = pDirectory->nUsedSlots;
+  _nFreeSlot = pDirectory->nFreeSlot;
+  _nGarbage = pDirectory->nGarbage;
+  spareLower = pDirectory->nSpareLower;
+  spareUpper = pDirectory->nSpareUpper;
+  slots = pDirectory->iSlots;
+}
+
+std::shared_ptr<const ToastDirectory> ToastPage::LoadDirectory(
+    PageID nPageID) {
+  std::shared_ptr<const ToastDirectory> pCached =
+      DirectoryCache().Get(nPageID);
+  if (pCached) return pCached;
+  // 固定页面一次，直接从页面中解码头部与槽数组
+  std::shared_ptr<ToastDirectory> pDirectory =
+      std::make_shared<ToastDirectory>();
+  {
+    ReadPageGuard iGuard(nPageID);
+    pDirectory->nNextID = iGuard.GetHeader<PageID>(NEXT_PAGE_OFFSET);
+    pDirectory->nPrevID = iGuard.GetHeader<PageID>(PREV_PAGE_OFFSET);
+    pDirectory->nUsedSlots = iGuard.GetHeader<SlotID>(USED_SLOTS_OFFSET);
+    SlotID slots_num = iGuard.GetHeader<SlotID>(SLOTS_NUM);
+    pDirectory->iSlots.resize(slots_num);
+    memcpy(pDirectory->iSlots.data(), iGuard.GetDataView(),
+           sizeof(Slot_t) * slots_num);
   }
-  Slot_t *data;
-  data = new Slot_t[slots_num];
-  GetData((uint8_t *)data, sizeof(Slot_t) * slots_num, 0);
-  slots.insert(slots.begin(), data, data + slots_num);
-  for (SlotID i = 0; i < slots.size(); ++i) {
-    if (HasRecord(i)) {
-      prev_len.push_back(slots[i].length);
-    } else {
-      prev_len.push_back(0);
+  // 空闲槽链表与空洞大小不落盘，解码槽数组时顺带重建。
+  // 空闲空间边界也由槽数组重新推出，旧版本页面中记错的边界因此得到修正。
+  PageOffset nUpper = MiniOS::GetOS()->GetDataSize();
+  Size nLive = 0;
+  SlotID nUsed = 0;
+  pDirectory->nFreeSlot = NULL_SLOT;
+  for (SlotID i = pDirectory->iSlots.size(); i-- > 0;) {
+    Slot_t &iSlot = pDirectory->iSlots[i];
+    if (iSlot.length == 0) {
+      iSlot.offset = pDirectory->nFreeSlot;
+      pDirectory->nFreeSlot = i;
+      continue;
     }
+    ++nUsed;
+    nLive += iSlot.length;
+    if (iSlot.offset < nUpper) nUpper = iSlot.offset;
   }
-  delete[] data;
+  pDirectory->nUsedSlots = nUsed;
+  pDirectory->nSpareLower = sizeof(Slot_t) * pDirectory->iSlots.size();
+  pDirectory->nSpareUpper = nUpper;
+  pDirectory->nGarbage = MiniOS::GetOS()->GetDataSize() - nUpper - nLive;
+  DirectoryCache().Put(nPageID, pDirectory);
+  return pDirectory;
 }
 
 ToastPage::~ToastPage() {
+  if (!_bDirty) return;
+  WritePageGuard iGuard(_nPageID);
   SlotID slots_num = (SlotID)slots.size();
-  SetHeader((uint8_t *)&_usedSlots, sizeof(SlotID), USED_SLOTS_OFFSET);
-  SetHeader((uint8_t *)&slots_num, sizeof(SlotID), SLOTS_NUM);
-  SetHeader((uint8_t *)&spareLower, sizeof(PageOffset), SPEAR_LOWER_OFFSET);
-  SetHeader((uint8_t *)&spareUpper, sizeof(PageOffset), SPEAR_UPPER_OFFSET);
-  SetData((uint8_t *)slots.data(), sizeof(Slot_t) * slots.size(), 0);
-}
-
-void ToastPage::RearrangeRec(SlotID nSlotID) {
-  if (_usedSlots == 0) return;
-  if (slots[nSlotID].offset + slots[nSlotID].length - spareUpper == 0) return;
-  uint8_t *data = new uint8_t[DATA_SIZE - spareUpper];
-  PageOffset delta = prev_len[nSlotID] - slots[nSlotID].length;
-  if (delta > 0) {
-    GetData(data, slots[nSlotID].offset + slots[nSlotID].length - spareUpper,
-            spareUpper);
-    SetData(data, slots[nSlotID].offset + slots[nSlotID].length - spareUpper,
-            spareUpper + delta);
+  iGuard.SetHeader(USED_SLOTS_OFFSET, _usedSlots);
+  iGuard.SetHeader(SLOTS_NUM, slots_num);
+  iGuard.SetHeader(SPEAR_LOWER_OFFSET, spareLower);
+  iGuard.SetHeader(SPEAR_UPPER_OFFSET, spareUpper);
+  memcpy(iGuard.GetMutableData(), slots.data(), sizeof(Slot_t) * slots.size());
+}
+
+/**
+ * @brief 转发槽与迁出记录共用的头部。
+ * 记录数据以字符串字段数量开头，不会取到两个标记值。
+ */
+struct ForwardHeader {
+  uint16_t nMark;
+  SlotID nSlotID;
+  PageID nPageID;
+};
+static_assert(sizeof(ForwardHeader) == FORWARD_SIZE, "forward header size");
+
+/**
+ * @brief 转发槽标记，数据为指向记录新位置的头部
+ */
+const uint16_t REDIRECT_MARK = 0xFFFF;
+/**
+ * @brief 迁出记录标记，头部指回记录的原始槽，其后为记录数据
+ */
+const uint16_t MOVED_MARK = 0xFFFE;
+
+void ToastPage::Compact() {
+  // 按槽顺序把存活记录重新紧密排列到数据区末尾，空洞全部并入空闲空间
+  PageOffset nDataSize = MiniOS::GetOS()->GetDataSize();
+  std::vector<uint8_t> iBuffer(nDataSize - spareUpper);
+  const uint8_t *pData = GetDataView();
+  PageOffset nUpper = nDataSize;
+  for (auto &iSlot : slots) {
+    if (iSlot.length == 0) continue;
+    nUpper -= iSlot.length;
+    memcpy(iBuffer.data() + (nUpper - spareUpper), pData + iSlot.offset,
+           iSlot.length);
+    iSlot.offset = nUpper;
+  }
+  SetData(iBuffer.data() + (nUpper - spareUpper), nDataSize - nUpper, nUpper);
+  spareUpper = nUpper;
+  _nGarbage = 0;
+  _bDirty = true;
+}
+
+PageOffset ToastPage::Allocate(PageOffset nSize, bool bNewSlot) {
+  // 连续空闲空间不足时才整理页面，删除操作本身不移动数据
+  int nNeed = nSize;
+  if (bNewSlot && _nFreeSlot == NULL_SLOT) nNeed += sizeof(Slot_t);
+  if (spareUpper - spareLower < nNeed) Compact();
+  spareUpper -= nSize;
+  return spareUpper;
+}
+
+void ToastPage::Release(SlotID nSlotID) {
+  // 紧邻空闲空间的记录直接归还，其余记录留下空洞，等插入需要时再整理
+  if (slots[nSlotID].offset == spareUpper)
+    spareUpper += slots[nSlotID].length;
+  else
+    _nGarbage += slots[nSlotID].length;
+  slots[nSlotID].length = 0;
+}
+
+SlotID ToastPage::TakeSlot(PageOffset nOffset, PageOffset nSize) {
+  _usedSlots += 1;
+  if (_nFreeSlot != NULL_SLOT) {
+    SlotID nSlotID = _nFreeSlot;
+    _nFreeSlot = slots[nSlotID].offset;
+    slots[nSlotID] = Slot_t(nSize, nOffset);
+    return nSlotID;
+  }
+  slots.push_back(Slot_t(nSize, nOffset));
+  spareLower += sizeof(Slot_t);
+  return slots.size() - 1;
+}
+
+void ToastPage::WriteRecord(PageOffset nOffset, const uint8_t *pHeader,
+                            const uint8_t *src, PageOffset len,
+                            PageOffset nSize) {
+  PageOffset nPos = nOffset;
+  if (pHeader) {
+    SetData(pHeader, FORWARD_SIZE, nPos);
+    nPos += FORWARD_SIZE;
   }
-  spareLower += delta;
-  for (SlotID i = 0; i < slots.size(); ++i) {
-    if (HasRecord(i) && slots[i].offset <= slots[nSlotID].offset)
-      slots[i].offset += delta;
+  SetData(src, len, nPos);
+  nPos += len;
+  // 不足FORWARD_SIZE的记录补零，保证任何记录都能原地改写为转发槽
+  if (nPos < nOffset + nSize) {
+    uint8_t pZero[FORWARD_SIZE] = {0};
+    SetData(pZero, nOffset + nSize - nPos, nPos);
   }
 }
 
+static PageOffset SlotSize(PageOffset len) {
+  return (len < FORWARD_SIZE) ? FORWARD_SIZE : len;
+}
+
 bool ToastPage::Full(const PageOffset len) const {
-  if (_usedSlots < slots.size()) return len > spareUpper - spareLower;
-  return len + (PageOffset)sizeof(Slot_t) > spareUpper - spareLower;
+  return SlotSize(len) > GetFreeSize();
+}
+
+PageOffset ToastPage::GetFreeSize() const {
+  int nSpare = spareUpper - spareLower + _nGarbage;
+  if (_nFreeSlot == NULL_SLOT) nSpare -= sizeof(Slot_t);
+  return (nSpare > 0) ? nSpare : 0;
 }
+
 Size ToastPage::GetUsed() const { return _usedSlots; };
 
+PageOffset ToastPage::GetMaxRecordSize() {
+  return MiniOS::GetOS()->GetDataSize() - sizeof(Slot_t) - FORWARD_SIZE;
+}
+
 SlotID ToastPage::InsertRecord(const uint8_t *src, const PageOffset len) {
   if (Full(len)) throw ToastPageFullException();
-  spareUpper -= len;
-  SetData(src, len, spareUpper);
+  _bDirty = true;
+  PageOffset nSize = SlotSize(len);
+  PageOffset nOffset = Allocate(nSize, true);
+  WriteRecord(nOffset, nullptr, src, len, nSize);
+  return TakeSlot(nOffset, nSize);
+}
 
-  _usedSlots += 1;
-  for (SlotID i = 0; i < slots.size(); ++i) {
-    if (!HasRecord(i)) {
-      slots[i].offset = spareUpper;
-      slots[i].length = len;
-      return i;
-    }
-  }
-  Slot_t temp(len, spareUpper);
-  slots.push_back(temp);
-  spareLower += sizeof(Slot_t);
-  return slots.size() - 1;
+SlotID ToastPage::InsertMovedRecord(const uint8_t *src, const PageOffset len,
+                                    const PageSlotID &iHome) {
+  if (Full(len + FORWARD_SIZE)) throw ToastPageFullException();
+  _bDirty = true;
+  ForwardHeader iHeader{MOVED_MARK, iHome.second, iHome.first};
+  PageOffset nSize = len + FORWARD_SIZE;
+  PageOffset nOffset = Allocate(nSize, true);
+  WriteRecord(nOffset, (const uint8_t *)&iHeader, src, len, nSize);
+  return TakeSlot(nOffset, nSize);
 }
 
 uint8_t *ToastPage::GetRecord(SlotID nSlotID) {
@@ -104,35 +257,134 @@ uint8_t *ToastPage::GetRecord(SlotID nSlotID) {
   // TIPS: 使用GetData实现读数据
   // TIPS: 注意需要使用new分配_nFixed大小的空间
   // LAB1 END
-  if (!HasRecord(nSlotID)) throw ToastPageException(nSlotID);
-  uint8_t *data = new uint8_t[slots[nSlotID].length];
-  GetData(data, slots[nSlotID].length, slots[nSlotID].offset);
+  PageOffset nSize = GetRecordSize(nSlotID);
+  uint8_t *data = new uint8_t[nSize];
+  memcpy(data, ViewRecord(nSlotID), nSize);
   return data;
 }
 
+const uint8_t *ToastPage::ViewRecord(SlotID nSlotID) const {
+  if (!HasRecord(nSlotID)) throw ToastPageException(nSlotID);
+  const uint8_t *pData = GetDataView() + slots[nSlotID].offset;
+  return (GetMark(nSlotID) == MOVED_MARK) ? pData + FORWARD_SIZE : pData;
+}
+
+void ToastPage::Scan(const RecordFilter *pFilter, std::vector<SlotID> &iSlotVec,
+                     std::vector<SlotID> &iRedirectVec) const {
+  const uint8_t *pData = GetDataView();
+  for (SlotID nSlot = 0; nSlot < slots.size(); ++nSlot) {
+    if (slots[nSlot].length == 0) continue;
+    // 迁出记录经由原始槽访问，避免同一行被扫描两次
+    uint16_t nMark = GetMark(nSlot);
+    if (nMark == MOVED_MARK) continue;
+    if (nMark == REDIRECT_MARK) {
+      iRedirectVec.push_back(nSlot);
+      continue;
+    }
+    if (pFilter && !pFilter->Match(pData + slots[nSlot].offset)) continue;
+    iSlotVec.push_back(nSlot);
+  }
+}
+
+PageOffset ToastPage::GetRecordSize(SlotID nSlotID) const {
+  if (!HasRecord(nSlotID)) throw ToastPageException(nSlotID);
+  if (GetMark(nSlotID) == MOVED_MARK)
+    return slots[nSlotID].length - FORWARD_SIZE;
+  return slots[nSlotID].length;
+}
+
 bool ToastPage::HasRecord(SlotID nSlotID) const {
   return slots[nSlotID].length > 0;
 }
 
+uint16_t ToastPage::GetMark(SlotID nSlotID) const {
+  uint16_t nMark;
+  memcpy(&nMark, GetDataView() + slots[nSlotID].offset, sizeof(uint16_t));
+  return nMark;
+}
+
+bool ToastPage::IsRedirect(SlotID nSlotID) const {
+  if (!HasRecord(nSlotID)) throw ToastPageException(nSlotID);
+  return GetMark(nSlotID) == REDIRECT_MARK;
+}
+
+bool ToastPage::IsMoved(SlotID nSlotID) const {
+  if (!HasRecord(nSlotID)) throw ToastPageException(nSlotID);
+  return GetMark(nSlotID) == MOVED_MARK;
+}
+
+PageSlotID ToastPage::GetRedirect(SlotID nSlotID) const {
+  if (!IsRedirect(nSlotID)) throw ToastPageException(nSlotID);
+  ForwardHeader iHeader;
+  memcpy(&iHeader, GetDataView() + slots[nSlotID].offset, FORWARD_SIZE);
+  return PageSlotID(iHeader.nPageID, iHeader.nSlotID);
+}
+
+void ToastPage::SetRedirect(SlotID nSlotID, const PageSlotID &iTarget) {
+  if (!HasRecord(nSlotID)) throw ToastPageException(nSlotID);
+  ForwardHeader iHeader{REDIRECT_MARK, iTarget.second, iTarget.first};
+  if (slots[nSlotID].length < FORWARD_SIZE) {
+    // 旧版本页面中的短记录没有补齐，需要在本页重新分配
+    UpdateRecord(nSlotID, (const uint8_t *)&iHeader, FORWARD_SIZE);
+    return;
+  }
+  // 新写入的槽至少占用FORWARD_SIZE字节，转发头总能原地写入
+  _bDirty = true;
+  SetData((const uint8_t *)&iHeader, FORWARD_SIZE, slots[nSlotID].offset);
+  _nGarbage += slots[nSlotID].length - FORWARD_SIZE;
+  slots[nSlotID].length = FORWARD_SIZE;
+}
+
+bool ToastPage::CanRedirect(SlotID nSlotID) const {
+  if (!HasRecord(nSlotID)) throw ToastPageException(nSlotID);
+  if (slots[nSlotID].length >= FORWARD_SIZE) return true;
+  return CanUpdate(nSlotID, FORWARD_SIZE);
+}
+
 void ToastPage::DeleteRecord(SlotID nSlotID) {
   if (!HasRecord(nSlotID)) throw ToastPageException(nSlotID);
-  //删除记录，直接将slot的长度置为0
-  slots[nSlotID].length = 0;
+  _bDirty = true;
+  Release(nSlotID);
+  // 空槽的offset字段用于串联空闲槽链表
+  slots[nSlotID] = Slot_t(0, _nFreeSlot);
+  _nFreeSlot = nSlotID;
   _usedSlots -= 1;
-  RearrangeRec(nSlotID);
-  return;
+  if (_usedSlots == 0) {
+    spareUpper = MiniOS::GetOS()->GetDataSize();
+    _nGarbage = 0;
+  }
+}
+
+bool ToastPage::CanUpdate(SlotID nSlotID, const PageOffset len) const {
+  if (!HasRecord(nSlotID)) throw ToastPageException(nSlotID);
+  int nSize = SlotSize(len);
+  if (GetMark(nSlotID) == MOVED_MARK) nSize += FORWARD_SIZE;
+  return nSize <=
+         spareUpper - spareLower + _nGarbage + slots[nSlotID].length;
 }
 
 void ToastPage::UpdateRecord(SlotID nSlotID, const uint8_t *src,
                              const PageOffset len) {
-  if (!HasRecord(nSlotID)) throw ToastPageException(nSlotID);
-  if (len <= slots[nSlotID].length) {
-    SetData(src, len, slots[nSlotID].offset);
-    slots[nSlotID].length = len;
-    RearrangeRec(nSlotID);
-  } else {
-    throw ToastPageFullException();
+  if (!CanUpdate(nSlotID, len)) throw ToastPageFullException();
+  _bDirty = true;
+  // 迁出记录保留指回原始槽的头部，转发槽则被完整记录替换
+  ForwardHeader iHeader;
+  bool bMoved = (GetMark(nSlotID) == MOVED_MARK);
+  if (bMoved)
+    memcpy(&iHeader, GetDataView() + slots[nSlotID].offset, FORWARD_SIZE);
+  PageOffset nSize = SlotSize(len) + (bMoved ? FORWARD_SIZE : 0);
+  const uint8_t *pHeader = bMoved ? (const uint8_t *)&iHeader : nullptr;
+  if (nSize <= slots[nSlotID].length) {
+    WriteRecord(slots[nSlotID].offset, pHeader, src, len, nSize);
+    _nGarbage += slots[nSlotID].length - nSize;
+    slots[nSlotID].length = nSize;
+    return;
   }
+  // 变长后在本页重新分配空间，槽编号保持不变
+  Release(nSlotID);
+  PageOffset nOffset = Allocate(nSize, false);
+  WriteRecord(nOffset, pHeader, src, len, nSize);
+  slots[nSlotID] = Slot_t(nSize, nOffset);
 }
 
 }  // namespace thdb
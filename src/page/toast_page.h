@@ -1,11 +1,21 @@
 #ifndef THDB_TOAST_PAGE_H_
 #define THDB_TOAST_PAGE_H_
 
+#include <memory>
+
 #include "page/linked_page.h"
+#include "record/record_filter.h"
 #include "utils/bitmap.h"
 
 namespace thdb {
 
+/**
+ * @brief 转发头的长度，也是每个槽占用的最小空间
+ */
+const PageOffset FORWARD_SIZE = 8;
+
+struct ToastDirectory;
+
 /**
  * @brief 变长记录页面。
  *
@@ -14,6 +24,11 @@ class ToastPage : public LinkedPage {
  public:
   ToastPage();
   ToastPage(PageID nPageID);
+  /**
+   * @brief 在nOwner的区段中构建一个新的变长记录页面
+   * @param nOwner 所属表的页面编号
+   */
+  ToastPage(PageID nOwner, NewPageTag);
   ~ToastPage();
 
   /**
@@ -23,6 +38,14 @@ class ToastPage : public LinkedPage {
    * @return SlotID 插入位置的槽编号
    */
   SlotID InsertRecord(const uint8_t *src, const PageOffset len);
+  /**
+   * @brief 插入一条从其他槽迁出的记录，记录前带有指回原始槽的头部
+   *
+   * @param iHome 记录的原始位置
+   * @return SlotID 插入位置的槽编号
+   */
+  SlotID InsertMovedRecord(const uint8_t *src, const PageOffset len,
+                           const PageSlotID &iHome);
   /**
    * @brief 获取指定位置的记录的内容
    *
@@ -30,6 +53,50 @@ class ToastPage : public LinkedPage {
    * @return uint8_t* 记录定长格式化的内容
    */
   uint8_t *GetRecord(SlotID nSlotID);
+  /**
+   * @brief 获取指定位置记录内容的只读视图，不复制记录。
+   * 迁出记录返回跳过头部后的数据。
+   *
+   * @param nSlotID 槽编号
+   * @return const uint8_t* 记录内容地址，有效期与MiniOS::View相同
+   */
+  const uint8_t *ViewRecord(SlotID nSlotID) const;
+  /**
+   * @brief 获取指定位置记录的长度
+   */
+  PageOffset GetRecordSize(SlotID nSlotID) const;
+  /**
+   * @brief 在页面数据上直接求值过滤器，收集满足条件的槽编号。
+   * 不满足条件的记录既不复制也不解码。迁出记录跳过，
+   * 转发槽不经过滤直接收集，由调用者到目标页面读取。
+   *
+   * @param pFilter 过滤器，为nullptr时收集全部记录
+   * @param iSlotVec 满足条件的槽编号，按槽编号升序追加
+   * @param iRedirectVec 转发槽编号，按槽编号升序追加
+   */
+  void Scan(const RecordFilter *pFilter, std::vector<SlotID> &iSlotVec,
+            std::vector<SlotID> &iRedirectVec) const;
+  /**
+   * @brief 判断槽是否为转发槽
+   */
+  bool IsRedirect(SlotID nSlotID) const;
+  /**
+   * @brief 判断槽是否存放从其他槽迁出的记录
+   */
+  bool IsMoved(SlotID nSlotID) const;
+  /**
+   * @brief 获得转发槽指向的记录位置
+   */
+  PageSlotID GetRedirect(SlotID nSlotID) const;
+  /**
+   * @brief 将槽原地改写为指向iTarget的转发槽，槽编号保持不变
+   */
+  void SetRedirect(SlotID nSlotID, const PageSlotID &iTarget);
+  /**
+   * @brief 判断槽能否改写为转发槽。
+   * 旧版本页面中短于FORWARD_SIZE的槽需要在本页重新分配，本页已满时返回false
+   */
+  bool CanRedirect(SlotID nSlotID) const;
   /**
    * @brief 判断某一个槽是否存在记录
    *
@@ -45,7 +112,13 @@ class ToastPage : public LinkedPage {
    */
   void DeleteRecord(SlotID nSlotID);
   /**
-   * @brief 原地更新一条记录的内容
+   * @brief 判断本页能否容纳槽更新后的内容
+   */
+  bool CanUpdate(SlotID nSlotID, const PageOffset len) const;
+  /**
+   * @brief 更新一条记录的内容，槽编号保持不变。
+   * 变长时在本页内重新分配空间，本页无法容纳时抛出ToastPageFullException。
+   * 转发槽被替换为完整记录，迁出记录保留其头部。
    *
    * @param nSlotID 槽编号
    * @param src 新的变长格式化内容
@@ -53,11 +126,64 @@ class ToastPage : public LinkedPage {
   void UpdateRecord(SlotID nSlotID, const uint8_t *src, const PageOffset len);
 
   bool Full(const PageOffset len) const;
+  /**
+   * @brief 获得页面能容纳的最长新记录长度，与Full的判断一致
+   */
+  PageOffset GetFreeSize() const;
   Size GetUsed() const;
+  /**
+   * @brief 获得空页面能容纳的最长记录，为记录迁出时的转发头预留空间
+   */
+  static PageOffset GetMaxRecordSize();
 
  private:
-  void RearrangeRec(SlotID nSlotID);
+  ToastPage(PageID nPageID, std::shared_ptr<const ToastDirectory> pDirectory);
+  /**
+   * @brief 获得页面的槽目录，优先使用缓存中的解码结果
+   */
+  static std::shared_ptr<const ToastDirectory> LoadDirectory(PageID nPageID);
+  friend struct ToastDirectory;
+
+  /**
+   * @brief 整理页面，将存活记录紧密排列，回收所有空洞
+   */
+  void Compact();
+  /**
+   * @brief 分配nSize字节的连续空间，必要时整理页面，返回其偏移
+   *
+   * @param bNewSlot 是否还需要为新槽预留空间
+   */
+  PageOffset Allocate(PageOffset nSize, bool bNewSlot);
+  /**
+   * @brief 归还槽占用的数据空间
+   */
+  void Release(SlotID nSlotID);
+  /**
+   * @brief 取一个空闲槽或追加新槽，指向已分配的空间
+   */
+  SlotID TakeSlot(PageOffset nOffset, PageOffset nSize);
+  /**
+   * @brief 写入可选的转发头与记录数据，不足nSize的部分补零
+   */
+  void WriteRecord(PageOffset nOffset, const uint8_t *pHeader,
+                   const uint8_t *src, PageOffset len, PageOffset nSize);
+  /**
+   * @brief 读取槽数据开头的标记
+   */
+  uint16_t GetMark(SlotID nSlotID) const;
+  /**
+   * @brief 槽数组或页面头是否被修改，未修改时析构不写回页面
+   */
+  bool _bDirty;
   SlotID _usedSlots;
+  /**
+   * @brief 空闲槽链表头，空槽的offset字段存放下一个空闲槽编号
+   */
+  SlotID _nFreeSlot;
+  /**
+   * @brief 数据区中已删除或缩短的记录留下的空洞总长度
+   */
+  PageOffset _nGarbage;
   //槽
   struct Slot_t {
     PageOffset length;
@@ -74,8 +200,7 @@ class ToastPage : public LinkedPage {
   PageOffset spareUpper; /* 空闲空间的终止地址，终止地址 - 起始地址 =
                              剩余空闲空间的大小 */
 
-  std::vector<Slot_t> slots;        /* 槽数据 */
-  std::vector<PageOffset> prev_len; /* 初始槽长 */
+  std::vector<Slot_t> slots; /* 槽数据 */
 };
 
 }  // namespace thdb
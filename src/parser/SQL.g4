@@ -31,6 +31,7 @@ statement
     | index_statement ';'
     | Annotation ';'
     | Null ';'
+    | vacuum_statement ';'
     ;
 
 db_statement
@@ -39,7 +40,7 @@ db_statement
     ;
 
 table_statement
-    : 'CREATE' 'TABLE' Identifier '(' field_list ')'                    # create_table
+    : 'CREATE' 'TABLE' Identifier '(' field_list ')' table_options?     # create_table
     | 'DROP' 'TABLE' Identifier                                         # drop_table
     | 'DESC' Identifier                                                 # describe_table
     | 'INSERT' 'INTO' Identifier 'VALUES' value_lists                   # insert_into_table
@@ -140,3 +141,11 @@ aggregator
     | Min
     | Sum
     ;
+
+table_options
+    : 'WITH' '(' Identifier EqualOrAssign Identifier ')'
+    ;
+
+vacuum_statement
+    : 'VACUUM' Identifier
+    ;
@@ -135,6 +135,14 @@ public:
     return visitChildren(ctx);
   }
 
+  virtual antlrcpp::Any visitTable_options(SQLParser::Table_optionsContext *ctx) override {
+    return visitChildren(ctx);
+  }
+
+  virtual antlrcpp::Any visitVacuum_statement(SQLParser::Vacuum_statementContext *ctx) override {
+    return visitChildren(ctx);
+  }
+
 
 };
 
@@ -64,10 +64,11 @@ std::vector<std::string> SQLLexer::_ruleNames = {
   u8"T__7", u8"T__8", u8"T__9", u8"T__10", u8"T__11", u8"T__12", u8"T__13", 
   u8"T__14", u8"T__15", u8"T__16", u8"T__17", u8"T__18", u8"T__19", u8"T__20", 
   u8"T__21", u8"T__22", u8"T__23", u8"T__24", u8"T__25", u8"T__26", u8"T__27", 
-  u8"T__28", u8"T__29", u8"T__30", u8"T__31", u8"T__32", u8"EqualOrAssign", 
-  u8"Less", u8"LessEqual", u8"Greater", u8"GreaterEqual", u8"NotEqual", 
-  u8"Count", u8"Average", u8"Max", u8"Min", u8"Sum", u8"Null", u8"Identifier", 
-  u8"Integer", u8"String", u8"Float", u8"Whitespace", u8"Annotation"
+  u8"T__28", u8"T__29", u8"T__30", u8"T__31", u8"T__32", u8"T__33", u8"T__34", 
+  u8"EqualOrAssign", u8"Less", u8"LessEqual", u8"Greater", u8"GreaterEqual", 
+  u8"NotEqual", u8"Count", u8"Average", u8"Max", u8"Min", u8"Sum", u8"Null", 
+  u8"Identifier", u8"Integer", u8"String", u8"Float", u8"Whitespace", 
+  u8"Annotation"
 };
 
 std::vector<std::string> SQLLexer::_channelNames = {
@@ -79,21 +80,23 @@ std::vector<std::string> SQLLexer::_modeNames = {
 };
 
 std::vector<std::string> SQLLexer::_literalNames = {
-  "", u8"';'", u8"'SHOW'", u8"'TABLES'", u8"'INDEXES'", u8"'CREATE'", u8"'TABLE'", 
-  u8"'('", u8"')'", u8"'DROP'", u8"'DESC'", u8"'INSERT'", u8"'INTO'", u8"'VALUES'", 
-  u8"'DELETE'", u8"'FROM'", u8"'WHERE'", u8"'UPDATE'", u8"'SET'", u8"'SELECT'", 
-  u8"'GROUP'", u8"'BY'", u8"'LIMIT'", u8"'OFFSET'", u8"'ALTER'", u8"'ADD'", 
-  u8"'INDEX'", u8"','", u8"'INT'", u8"'VARCHAR'", u8"'FLOAT'", u8"'AND'", 
-  u8"'.'", u8"'*'", u8"'='", u8"'<'", u8"'<='", u8"'>'", u8"'>='", u8"'<>'", 
-  u8"'COUNT'", u8"'AVG'", u8"'MAX'", u8"'MIN'", u8"'SUM'", u8"'NULL'"
+  "", u8"';'", u8"'SHOW'", u8"'TABLES'", u8"'INDEXES'", u8"'CREATE'", 
+  u8"'TABLE'", u8"'('", u8"')'", u8"'DROP'", u8"'DESC'", u8"'INSERT'", 
+  u8"'INTO'", u8"'VALUES'", u8"'DELETE'", u8"'FROM'", u8"'WHERE'", u8"'UPDATE'", 
+  u8"'SET'", u8"'SELECT'", u8"'GROUP'", u8"'BY'", u8"'LIMIT'", u8"'OFFSET'", 
+  u8"'ALTER'", u8"'ADD'", u8"'INDEX'", u8"','", u8"'INT'", u8"'VARCHAR'", 
+  u8"'FLOAT'", u8"'AND'", u8"'.'", u8"'*'", u8"'WITH'", u8"'VACUUM'", u8"'='", 
+  u8"'<'", u8"'<='", u8"'>'", u8"'>='", u8"'<>'", u8"'COUNT'", u8"'AVG'", 
+  u8"'MAX'", u8"'MIN'", u8"'SUM'", u8"'NULL'"
 };
 
 std::vector<std::string> SQLLexer::_symbolicNames = {
-  "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", 
-  "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", u8"EqualOrAssign", 
-  u8"Less", u8"LessEqual", u8"Greater", u8"GreaterEqual", u8"NotEqual", 
-  u8"Count", u8"Average", u8"Max", u8"Min", u8"Sum", u8"Null", u8"Identifier", 
-  u8"Integer", u8"String", u8"Float", u8"Whitespace", u8"Annotation"
+  "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", 
+  "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", 
+  u8"EqualOrAssign", u8"Less", u8"LessEqual", u8"Greater", u8"GreaterEqual", 
+  u8"NotEqual", u8"Count", u8"Average", u8"Max", u8"Min", u8"Sum", u8"Null", 
+  u8"Identifier", u8"Integer", u8"String", u8"Float", u8"Whitespace", 
+  u8"Annotation"
 };
 
 dfa::Vocabulary SQLLexer::_vocabulary(_literalNames, _symbolicNames);
@@ -117,7 +120,7 @@ SQLLexer::Initializer::Initializer() {
 
   _serializedATN = {
     0x3, 0x608b, 0xa72a, 0x8133, 0xb9ed, 0x417c, 0x3be7, 0x7786, 0x5964, 
-    0x2, 0x35, 0x16f, 0x8, 0x1, 0x4, 0x2, 0x9, 0x2, 0x4, 0x3, 0x9, 0x3, 
+    0x2, 0x37, 0x17f, 0x8, 0x1, 0x4, 0x2, 0x9, 0x2, 0x4, 0x3, 0x9, 0x3, 
     0x4, 0x4, 0x9, 0x4, 0x4, 0x5, 0x9, 0x5, 0x4, 0x6, 0x9, 0x6, 0x4, 0x7, 
     0x9, 0x7, 0x4, 0x8, 0x9, 0x8, 0x4, 0x9, 0x9, 0x9, 0x4, 0xa, 0x9, 0xa, 
     0x4, 0xb, 0x9, 0xb, 0x4, 0xc, 0x9, 0xc, 0x4, 0xd, 0x9, 0xd, 0x4, 0xe, 
@@ -127,12 +130,12 @@ SQLLexer::Initializer::Initializer() {
     0x18, 0x9, 0x18, 0x4, 0x19, 0x9, 0x19, 0x4, 0x1a, 0x9, 0x1a, 0x4, 0x1b, 
     0x9, 0x1b, 0x4, 0x1c, 0x9, 0x1c, 0x4, 0x1d, 0x9, 0x1d, 0x4, 0x1e, 0x9, 
     0x1e, 0x4, 0x1f, 0x9, 0x1f, 0x4, 0x20, 0x9, 0x20, 0x4, 0x21, 0x9, 0x21, 
-    0x4, 0x22, 0x9, 0x22, 0x4, 0x23, 0x9, 0x23, 0x4, 0x24, 0x9, 0x24, 0x4, 
-    0x25, 0x9, 0x25, 0x4, 0x26, 0x9, 0x26, 0x4, 0x27, 0x9, 0x27, 0x4, 0x28, 
-    0x9, 0x28, 0x4, 0x29, 0x9, 0x29, 0x4, 0x2a, 0x9, 0x2a, 0x4, 0x2b, 0x9, 
-    0x2b, 0x4, 0x2c, 0x9, 0x2c, 0x4, 0x2d, 0x9, 0x2d, 0x4, 0x2e, 0x9, 0x2e, 
-    0x4, 0x2f, 0x9, 0x2f, 0x4, 0x30, 0x9, 0x30, 0x4, 0x31, 0x9, 0x31, 0x4, 
-    0x32, 0x9, 0x32, 0x4, 0x33, 0x9, 0x33, 0x4, 0x34, 0x9, 0x34, 0x3, 0x2, 
+    0x4, 0x22, 0x9, 0x22, 0x4, 0x25, 0x9, 0x25, 0x4, 0x26, 0x9, 0x26, 0x4, 
+    0x27, 0x9, 0x27, 0x4, 0x28, 0x9, 0x28, 0x4, 0x29, 0x9, 0x29, 0x4, 0x2a, 
+    0x9, 0x2a, 0x4, 0x2b, 0x9, 0x2b, 0x4, 0x2c, 0x9, 0x2c, 0x4, 0x2d, 0x9, 
+    0x2d, 0x4, 0x2e, 0x9, 0x2e, 0x4, 0x2f, 0x9, 0x2f, 0x4, 0x30, 0x9, 0x30, 
+    0x4, 0x31, 0x9, 0x31, 0x4, 0x32, 0x9, 0x32, 0x4, 0x33, 0x9, 0x33, 0x4, 
+    0x34, 0x9, 0x34, 0x4, 0x35, 0x9, 0x35, 0x4, 0x36, 0x9, 0x36, 0x3, 0x2, 
     0x3, 0x2, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x4, 
     0x3, 0x4, 0x3, 0x4, 0x3, 0x4, 0x3, 0x4, 0x3, 0x4, 0x3, 0x4, 0x3, 0x5, 
     0x3, 0x5, 0x3, 0x5, 0x3, 0x5, 0x3, 0x5, 0x3, 0x5, 0x3, 0x5, 0x3, 0x5, 
@@ -158,40 +161,43 @@ SQLLexer::Initializer::Initializer() {
     0x1e, 0x3, 0x1e, 0x3, 0x1e, 0x3, 0x1e, 0x3, 0x1e, 0x3, 0x1e, 0x3, 0x1e, 
     0x3, 0x1f, 0x3, 0x1f, 0x3, 0x1f, 0x3, 0x1f, 0x3, 0x1f, 0x3, 0x1f, 0x3, 
     0x20, 0x3, 0x20, 0x3, 0x20, 0x3, 0x20, 0x3, 0x21, 0x3, 0x21, 0x3, 0x22, 
-    0x3, 0x22, 0x3, 0x23, 0x3, 0x23, 0x3, 0x24, 0x3, 0x24, 0x3, 0x25, 0x3, 
-    0x25, 0x3, 0x25, 0x3, 0x26, 0x3, 0x26, 0x3, 0x27, 0x3, 0x27, 0x3, 0x27, 
-    0x3, 0x28, 0x3, 0x28, 0x3, 0x28, 0x3, 0x29, 0x3, 0x29, 0x3, 0x29, 0x3, 
-    0x29, 0x3, 0x29, 0x3, 0x29, 0x3, 0x2a, 0x3, 0x2a, 0x3, 0x2a, 0x3, 0x2a, 
-    0x3, 0x2b, 0x3, 0x2b, 0x3, 0x2b, 0x3, 0x2b, 0x3, 0x2c, 0x3, 0x2c, 0x3, 
-    0x2c, 0x3, 0x2c, 0x3, 0x2d, 0x3, 0x2d, 0x3, 0x2d, 0x3, 0x2d, 0x3, 0x2e, 
-    0x3, 0x2e, 0x3, 0x2e, 0x3, 0x2e, 0x3, 0x2e, 0x3, 0x2f, 0x3, 0x2f, 0x7, 
-    0x2f, 0x140, 0xa, 0x2f, 0xc, 0x2f, 0xe, 0x2f, 0x143, 0xb, 0x2f, 0x3, 
-    0x30, 0x6, 0x30, 0x146, 0xa, 0x30, 0xd, 0x30, 0xe, 0x30, 0x147, 0x3, 
-    0x31, 0x3, 0x31, 0x7, 0x31, 0x14c, 0xa, 0x31, 0xc, 0x31, 0xe, 0x31, 
-    0x14f, 0xb, 0x31, 0x3, 0x31, 0x3, 0x31, 0x3, 0x32, 0x5, 0x32, 0x154, 
-    0xa, 0x32, 0x3, 0x32, 0x6, 0x32, 0x157, 0xa, 0x32, 0xd, 0x32, 0xe, 0x32, 
-    0x158, 0x3, 0x32, 0x3, 0x32, 0x7, 0x32, 0x15d, 0xa, 0x32, 0xc, 0x32, 
-    0xe, 0x32, 0x160, 0xb, 0x32, 0x3, 0x33, 0x6, 0x33, 0x163, 0xa, 0x33, 
-    0xd, 0x33, 0xe, 0x33, 0x164, 0x3, 0x33, 0x3, 0x33, 0x3, 0x34, 0x3, 0x34, 
-    0x3, 0x34, 0x6, 0x34, 0x16c, 0xa, 0x34, 0xd, 0x34, 0xe, 0x34, 0x16d, 
-    0x2, 0x2, 0x35, 0x3, 0x3, 0x5, 0x4, 0x7, 0x5, 0x9, 0x6, 0xb, 0x7, 0xd, 
-    0x8, 0xf, 0x9, 0x11, 0xa, 0x13, 0xb, 0x15, 0xc, 0x17, 0xd, 0x19, 0xe, 
-    0x1b, 0xf, 0x1d, 0x10, 0x1f, 0x11, 0x21, 0x12, 0x23, 0x13, 0x25, 0x14, 
-    0x27, 0x15, 0x29, 0x16, 0x2b, 0x17, 0x2d, 0x18, 0x2f, 0x19, 0x31, 0x1a, 
-    0x33, 0x1b, 0x35, 0x1c, 0x37, 0x1d, 0x39, 0x1e, 0x3b, 0x1f, 0x3d, 0x20, 
-    0x3f, 0x21, 0x41, 0x22, 0x43, 0x23, 0x45, 0x24, 0x47, 0x25, 0x49, 0x26, 
-    0x4b, 0x27, 0x4d, 0x28, 0x4f, 0x29, 0x51, 0x2a, 0x53, 0x2b, 0x55, 0x2c, 
-    0x57, 0x2d, 0x59, 0x2e, 0x5b, 0x2f, 0x5d, 0x30, 0x5f, 0x31, 0x61, 0x32, 
-    0x63, 0x33, 0x65, 0x34, 0x67, 0x35, 0x3, 0x2, 0x8, 0x5, 0x2, 0x43, 0x5c, 
-    0x61, 0x61, 0x63, 0x7c, 0x6, 0x2, 0x32, 0x3b, 0x43, 0x5c, 0x61, 0x61, 
-    0x63, 0x7c, 0x3, 0x2, 0x32, 0x3b, 0x3, 0x2, 0x29, 0x29, 0x5, 0x2, 0xb, 
-    0xc, 0xf, 0xf, 0x22, 0x22, 0x3, 0x2, 0x3d, 0x3d, 0x2, 0x176, 0x2, 0x3, 
-    0x3, 0x2, 0x2, 0x2, 0x2, 0x5, 0x3, 0x2, 0x2, 0x2, 0x2, 0x7, 0x3, 0x2, 
-    0x2, 0x2, 0x2, 0x9, 0x3, 0x2, 0x2, 0x2, 0x2, 0xb, 0x3, 0x2, 0x2, 0x2, 
-    0x2, 0xd, 0x3, 0x2, 0x2, 0x2, 0x2, 0xf, 0x3, 0x2, 0x2, 0x2, 0x2, 0x11, 
-    0x3, 0x2, 0x2, 0x2, 0x2, 0x13, 0x3, 0x2, 0x2, 0x2, 0x2, 0x15, 0x3, 0x2, 
-    0x2, 0x2, 0x2, 0x17, 0x3, 0x2, 0x2, 0x2, 0x2, 0x19, 0x3, 0x2, 0x2, 0x2, 
-    0x2, 0x1b, 0x3, 0x2, 0x2, 0x2, 0x2, 0x1d, 0x3, 0x2, 0x2, 0x2, 0x2, 0x1f, 
+    0x3, 0x22, 0x3, 0x25, 0x3, 0x25, 0x3, 0x26, 0x3, 0x26, 0x3, 0x27, 0x3, 
+    0x27, 0x3, 0x27, 0x3, 0x28, 0x3, 0x28, 0x3, 0x29, 0x3, 0x29, 0x3, 0x29, 
+    0x3, 0x2a, 0x3, 0x2a, 0x3, 0x2a, 0x3, 0x2b, 0x3, 0x2b, 0x3, 0x2b, 0x3, 
+    0x2b, 0x3, 0x2b, 0x3, 0x2b, 0x3, 0x2c, 0x3, 0x2c, 0x3, 0x2c, 0x3, 0x2c, 
+    0x3, 0x2d, 0x3, 0x2d, 0x3, 0x2d, 0x3, 0x2d, 0x3, 0x2e, 0x3, 0x2e, 0x3, 
+    0x2e, 0x3, 0x2e, 0x3, 0x2f, 0x3, 0x2f, 0x3, 0x2f, 0x3, 0x2f, 0x3, 0x30, 
+    0x3, 0x30, 0x3, 0x30, 0x3, 0x30, 0x3, 0x30, 0x3, 0x31, 0x3, 0x31, 0x7, 
+    0x31, 0x140, 0xa, 0x31, 0xc, 0x31, 0xe, 0x31, 0x143, 0xb, 0x31, 0x3, 
+    0x32, 0x6, 0x32, 0x146, 0xa, 0x32, 0xd, 0x32, 0xe, 0x32, 0x147, 0x3, 
+    0x33, 0x3, 0x33, 0x7, 0x33, 0x14c, 0xa, 0x33, 0xc, 0x33, 0xe, 0x33, 
+    0x14f, 0xb, 0x33, 0x3, 0x33, 0x3, 0x33, 0x3, 0x34, 0x5, 0x34, 0x154, 
+    0xa, 0x34, 0x3, 0x34, 0x6, 0x34, 0x157, 0xa, 0x34, 0xd, 0x34, 0xe, 0x34, 
+    0x158, 0x3, 0x34, 0x3, 0x34, 0x7, 0x34, 0x15d, 0xa, 0x34, 0xc, 0x34, 
+    0xe, 0x34, 0x160, 0xb, 0x34, 0x3, 0x35, 0x6, 0x35, 0x163, 0xa, 0x35, 
+    0xd, 0x35, 0xe, 0x35, 0x164, 0x3, 0x35, 0x3, 0x35, 0x3, 0x36, 0x3, 0x36, 
+    0x3, 0x36, 0x6, 0x36, 0x16c, 0xa, 0x36, 0xd, 0x36, 0xe, 0x36, 0x16d, 
+    0x4, 0x23, 0x9, 0x23, 0x3, 0x23, 0x3, 0x23, 0x3, 0x23, 0x3, 0x23, 0x3, 
+    0x23, 0x4, 0x24, 0x9, 0x24, 0x3, 0x24, 0x3, 0x24, 0x3, 0x24, 0x3, 0x24, 
+    0x3, 0x24, 0x3, 0x24, 0x3, 0x24, 0x2, 0x2, 0x37, 0x3, 0x3, 0x5, 0x4, 
+    0x7, 0x5, 0x9, 0x6, 0xb, 0x7, 0xd, 0x8, 0xf, 0x9, 0x11, 0xa, 0x13, 0xb, 
+    0x15, 0xc, 0x17, 0xd, 0x19, 0xe, 0x1b, 0xf, 0x1d, 0x10, 0x1f, 0x11, 
+    0x21, 0x12, 0x23, 0x13, 0x25, 0x14, 0x27, 0x15, 0x29, 0x16, 0x2b, 0x17, 
+    0x2d, 0x18, 0x2f, 0x19, 0x31, 0x1a, 0x33, 0x1b, 0x35, 0x1c, 0x37, 0x1d, 
+    0x39, 0x1e, 0x3b, 0x1f, 0x3d, 0x20, 0x3f, 0x21, 0x41, 0x22, 0x43, 0x23, 
+    0x16f, 0x24, 0x176, 0x25, 0x45, 0x26, 0x47, 0x27, 0x49, 0x28, 0x4b, 
+    0x29, 0x4d, 0x2a, 0x4f, 0x2b, 0x51, 0x2c, 0x53, 0x2d, 0x55, 0x2e, 0x57, 
+    0x2f, 0x59, 0x30, 0x5b, 0x31, 0x5d, 0x32, 0x5f, 0x33, 0x61, 0x34, 0x63, 
+    0x35, 0x65, 0x36, 0x67, 0x37, 0x3, 0x2, 0x8, 0x5, 0x2, 0x43, 0x5c, 0x61, 
+    0x61, 0x63, 0x7c, 0x6, 0x2, 0x32, 0x3b, 0x43, 0x5c, 0x61, 0x61, 0x63, 
+    0x7c, 0x3, 0x2, 0x32, 0x3b, 0x3, 0x2, 0x29, 0x29, 0x5, 0x2, 0xb, 0xc, 
+    0xf, 0xf, 0x22, 0x22, 0x3, 0x2, 0x3d, 0x3d, 0x2, 0x186, 0x2, 0x3, 0x3, 
+    0x2, 0x2, 0x2, 0x2, 0x5, 0x3, 0x2, 0x2, 0x2, 0x2, 0x7, 0x3, 0x2, 0x2, 
+    0x2, 0x2, 0x9, 0x3, 0x2, 0x2, 0x2, 0x2, 0xb, 0x3, 0x2, 0x2, 0x2, 0x2, 
+    0xd, 0x3, 0x2, 0x2, 0x2, 0x2, 0xf, 0x3, 0x2, 0x2, 0x2, 0x2, 0x11, 0x3, 
+    0x2, 0x2, 0x2, 0x2, 0x13, 0x3, 0x2, 0x2, 0x2, 0x2, 0x15, 0x3, 0x2, 0x2, 
+    0x2, 0x2, 0x17, 0x3, 0x2, 0x2, 0x2, 0x2, 0x19, 0x3, 0x2, 0x2, 0x2, 0x2, 
+    0x1b, 0x3, 0x2, 0x2, 0x2, 0x2, 0x1d, 0x3, 0x2, 0x2, 0x2, 0x2, 0x1f, 
     0x3, 0x2, 0x2, 0x2, 0x2, 0x21, 0x3, 0x2, 0x2, 0x2, 0x2, 0x23, 0x3, 0x2, 
     0x2, 0x2, 0x2, 0x25, 0x3, 0x2, 0x2, 0x2, 0x2, 0x27, 0x3, 0x2, 0x2, 0x2, 
     0x2, 0x29, 0x3, 0x2, 0x2, 0x2, 0x2, 0x2b, 0x3, 0x2, 0x2, 0x2, 0x2, 0x2d, 
@@ -200,7 +206,8 @@ SQLLexer::Initializer::Initializer() {
     0x2, 0x37, 0x3, 0x2, 0x2, 0x2, 0x2, 0x39, 0x3, 0x2, 0x2, 0x2, 0x2, 0x3b, 
     0x3, 0x2, 0x2, 0x2, 0x2, 0x3d, 0x3, 0x2, 0x2, 0x2, 0x2, 0x3f, 0x3, 0x2, 
     0x2, 0x2, 0x2, 0x41, 0x3, 0x2, 0x2, 0x2, 0x2, 0x43, 0x3, 0x2, 0x2, 0x2, 
-    0x2, 0x45, 0x3, 0x2, 0x2, 0x2, 0x2, 0x47, 0x3, 0x2, 0x2, 0x2, 0x2, 0x49, 
+    0x2, 0x16f, 0x3, 0x2, 0x2, 0x2, 0x2, 0x176, 0x3, 0x2, 0x2, 0x2, 0x2, 
+    0x45, 0x3, 0x2, 0x2, 0x2, 0x2, 0x47, 0x3, 0x2, 0x2, 0x2, 0x2, 0x49, 
     0x3, 0x2, 0x2, 0x2, 0x2, 0x4b, 0x3, 0x2, 0x2, 0x2, 0x2, 0x4d, 0x3, 0x2, 
     0x2, 0x2, 0x2, 0x4f, 0x3, 0x2, 0x2, 0x2, 0x2, 0x51, 0x3, 0x2, 0x2, 0x2, 
     0x2, 0x53, 0x3, 0x2, 0x2, 0x2, 0x2, 0x55, 0x3, 0x2, 0x2, 0x2, 0x2, 0x57, 
@@ -355,11 +362,18 @@ SQLLexer::Initializer::Initializer() {
     0x2, 0x161, 0x163, 0x9, 0x6, 0x2, 0x2, 0x162, 0x161, 0x3, 0x2, 0x2, 
     0x2, 0x163, 0x164, 0x3, 0x2, 0x2, 0x2, 0x164, 0x162, 0x3, 0x2, 0x2, 
     0x2, 0x164, 0x165, 0x3, 0x2, 0x2, 0x2, 0x165, 0x166, 0x3, 0x2, 0x2, 
-    0x2, 0x166, 0x167, 0x8, 0x33, 0x2, 0x2, 0x167, 0x66, 0x3, 0x2, 0x2, 
+    0x2, 0x166, 0x167, 0x8, 0x35, 0x2, 0x2, 0x167, 0x66, 0x3, 0x2, 0x2, 
     0x2, 0x168, 0x169, 0x7, 0x2f, 0x2, 0x2, 0x169, 0x16b, 0x7, 0x2f, 0x2, 
     0x2, 0x16a, 0x16c, 0xa, 0x7, 0x2, 0x2, 0x16b, 0x16a, 0x3, 0x2, 0x2, 
     0x2, 0x16c, 0x16d, 0x3, 0x2, 0x2, 0x2, 0x16d, 0x16b, 0x3, 0x2, 0x2, 
     0x2, 0x16d, 0x16e, 0x3, 0x2, 0x2, 0x2, 0x16e, 0x68, 0x3, 0x2, 0x2, 0x2, 
+    0x16f, 0x171, 0x3, 0x2, 0x2, 0x2, 0x171, 0x172, 0x7, 0x59, 0x2, 0x2, 
+    0x172, 0x173, 0x7, 0x4b, 0x2, 0x2, 0x173, 0x174, 0x7, 0x56, 0x2, 0x2, 
+    0x174, 0x175, 0x7, 0x4a, 0x2, 0x2, 0x175, 0x170, 0x3, 0x2, 0x2, 0x2, 
+    0x176, 0x178, 0x3, 0x2, 0x2, 0x2, 0x178, 0x179, 0x7, 0x58, 0x2, 0x2, 
+    0x179, 0x17a, 0x7, 0x43, 0x2, 0x2, 0x17a, 0x17b, 0x7, 0x45, 0x2, 0x2, 
+    0x17b, 0x17c, 0x7, 0x57, 0x2, 0x2, 0x17c, 0x17d, 0x7, 0x57, 0x2, 0x2, 
+    0x17d, 0x17e, 0x7, 0x4f, 0x2, 0x2, 0x17e, 0x177, 0x3, 0x2, 0x2, 0x2, 
     0xb, 0x2, 0x141, 0x147, 0x14d, 0x153, 0x158, 0x15e, 0x164, 0x16d, 0x3, 
     0x8, 0x2, 0x2, 
   };
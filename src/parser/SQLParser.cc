@@ -84,6 +84,7 @@ SQLParser::ProgramContext* SQLParser::program() {
       | (1ULL << SQLParser::T__16)
       | (1ULL << SQLParser::T__18)
       | (1ULL << SQLParser::T__23)
+      | (1ULL << SQLParser::T__34)
       | (1ULL << SQLParser::Null)
       | (1ULL << SQLParser::Annotation))) != 0)) {
       setState(44);
@@ -131,6 +132,10 @@ tree::TerminalNode* SQLParser::StatementContext::Null() {
   return getToken(SQLParser::Null, 0);
 }
 
+SQLParser::Vacuum_statementContext* SQLParser::StatementContext::vacuum_statement() {
+  return getRuleContext<SQLParser::Vacuum_statementContext>(0);
+}
+
 
 size_t SQLParser::StatementContext::getRuleIndex() const {
   return SQLParser::RuleStatement;
@@ -205,6 +210,15 @@ SQLParser::StatementContext* SQLParser::statement() {
         break;
       }
 
+      case SQLParser::T__34: {
+        enterOuterAlt(_localctx, 6);
+        setState(269);
+        vacuum_statement();
+        setState(270);
+        match(SQLParser::T__0);
+        break;
+      }
+
     default:
       throw NoViableAltException(this);
     }
@@ -358,6 +372,10 @@ SQLParser::Field_listContext* SQLParser::Create_tableContext::field_list() {
   return getRuleContext<SQLParser::Field_listContext>(0);
 }
 
+SQLParser::Table_optionsContext* SQLParser::Create_tableContext::table_options() {
+  return getRuleContext<SQLParser::Table_optionsContext>(0);
+}
+
 SQLParser::Create_tableContext::Create_tableContext(Table_statementContext *ctx) { copyFrom(ctx); }
 
 antlrcpp::Any SQLParser::Create_tableContext::accept(tree::ParseTreeVisitor *visitor) {
@@ -433,6 +451,7 @@ antlrcpp::Any SQLParser::Update_tableContext::accept(tree::ParseTreeVisitor *vis
 SQLParser::Table_statementContext* SQLParser::table_statement() {
   Table_statementContext *_localctx = _tracker.createInstance<Table_statementContext>(_ctx, getState());
   enterRule(_localctx, 6, SQLParser::RuleTable_statement);
+  size_t _la = 0;
 
   auto onExit = finally([=] {
     exitRule();
@@ -456,6 +475,14 @@ SQLParser::Table_statementContext* SQLParser::table_statement() {
         field_list();
         setState(78);
         match(SQLParser::T__7);
+        setState(256);
+        _errHandler->sync(this);
+
+        _la = _input->LA(1);
+        if (_la == SQLParser::T__33) {
+          setState(257);
+          table_options();
+        }
         break;
       }
 
@@ -1882,6 +1909,114 @@ SQLParser::AggregatorContext* SQLParser::aggregator() {
   return _localctx;
 }
 
+//----------------- Table_optionsContext ------------------------------------------------------------------
+
+SQLParser::Table_optionsContext::Table_optionsContext(ParserRuleContext *parent, size_t invokingState)
+  : ParserRuleContext(parent, invokingState) {
+}
+
+std::vector<tree::TerminalNode *> SQLParser::Table_optionsContext::Identifier() {
+  return getTokens(SQLParser::Identifier);
+}
+
+tree::TerminalNode* SQLParser::Table_optionsContext::Identifier(size_t i) {
+  return getToken(SQLParser::Identifier, i);
+}
+
+tree::TerminalNode* SQLParser::Table_optionsContext::EqualOrAssign() {
+  return getToken(SQLParser::EqualOrAssign, 0);
+}
+
+
+size_t SQLParser::Table_optionsContext::getRuleIndex() const {
+  return SQLParser::RuleTable_options;
+}
+
+antlrcpp::Any SQLParser::Table_optionsContext::accept(tree::ParseTreeVisitor *visitor) {
+  if (auto parserVisitor = dynamic_cast<SQLVisitor*>(visitor))
+    return parserVisitor->visitTable_options(this);
+  else
+    return visitor->visitChildren(this);
+}
+
+SQLParser::Table_optionsContext* SQLParser::table_options() {
+  Table_optionsContext *_localctx = _tracker.createInstance<Table_optionsContext>(_ctx, getState());
+  enterRule(_localctx, 254, SQLParser::RuleTable_options);
+
+  auto onExit = finally([=] {
+    exitRule();
+  });
+  try {
+    enterOuterAlt(_localctx, 1);
+    setState(260);
+    match(SQLParser::T__33);
+    setState(261);
+    match(SQLParser::T__6);
+    setState(262);
+    match(SQLParser::Identifier);
+    setState(263);
+    match(SQLParser::EqualOrAssign);
+    setState(264);
+    match(SQLParser::Identifier);
+    setState(265);
+    match(SQLParser::T__7);
+   
+  }
+  catch (RecognitionException &e) {
+    _errHandler->reportError(this, e);
+    _localctx->exception = std::current_exception();
+    _errHandler->recover(this, _localctx->exception);
+  }
+
+  return _localctx;
+}
+
+//----------------- Vacuum_statementContext ------------------------------------------------------------------
+
+SQLParser::Vacuum_statementContext::Vacuum_statementContext(ParserRuleContext *parent, size_t invokingState)
+  : ParserRuleContext(parent, invokingState) {
+}
+
+tree::TerminalNode* SQLParser::Vacuum_statementContext::Identifier() {
+  return getToken(SQLParser::Identifier, 0);
+}
+
+
+size_t SQLParser::Vacuum_statementContext::getRuleIndex() const {
+  return SQLParser::RuleVacuum_statement;
+}
+
+antlrcpp::Any SQLParser::Vacuum_statementContext::accept(tree::ParseTreeVisitor *visitor) {
+  if (auto parserVisitor = dynamic_cast<SQLVisitor*>(visitor))
+    return parserVisitor->visitVacuum_statement(this);
+  else
+    return visitor->visitChildren(this);
+}
+
+SQLParser::Vacuum_statementContext* SQLParser::vacuum_statement() {
+  Vacuum_statementContext *_localctx = _tracker.createInstance<Vacuum_statementContext>(_ctx, getState());
+  enterRule(_localctx, 267, SQLParser::RuleVacuum_statement);
+
+  auto onExit = finally([=] {
+    exitRule();
+  });
+  try {
+    enterOuterAlt(_localctx, 1);
+    setState(272);
+    match(SQLParser::T__34);
+    setState(273);
+    match(SQLParser::Identifier);
+   
+  }
+  catch (RecognitionException &e) {
+    _errHandler->reportError(this, e);
+    _localctx->exception = std::current_exception();
+    _errHandler->recover(this, _localctx->exception);
+  }
+
+  return _localctx;
+}
+
 // Static vars and initialization.
 std::vector<dfa::DFA> SQLParser::_decisionToDFA;
 atn::PredictionContextCache SQLParser::_sharedContextCache;
@@ -1892,9 +2027,10 @@ std::vector<uint16_t> SQLParser::_serializedATN;
 
 std::vector<std::string> SQLParser::_ruleNames = {
   "program", "statement", "db_statement", "table_statement", "select_table", 
-  "index_statement", "field_list", "field", "type_", "value_lists", "value_list", 
-  "value", "where_and_clause", "where_clause", "column", "expression", "set_clause", 
-  "selectors", "selector", "identifiers", "operate", "aggregator"
+  "index_statement", "field_list", "field", "type_", "value_lists", 
+  "value_list", "value", "where_and_clause", "where_clause", "column", 
+  "expression", "set_clause", "selectors", "selector", "identifiers", "operate", 
+  "aggregator", "table_options", "vacuum_statement"
 };
 
 std::vector<std::string> SQLParser::_literalNames = {
@@ -1902,16 +2038,17 @@ std::vector<std::string> SQLParser::_literalNames = {
   "')'", "'DROP'", "'DESC'", "'INSERT'", "'INTO'", "'VALUES'", "'DELETE'", 
   "'FROM'", "'WHERE'", "'UPDATE'", "'SET'", "'SELECT'", "'GROUP'", "'BY'", 
   "'LIMIT'", "'OFFSET'", "'ALTER'", "'ADD'", "'INDEX'", "','", "'INT'", 
-  "'VARCHAR'", "'FLOAT'", "'AND'", "'.'", "'*'", "'='", "'<'", "'<='", "'>'", 
-  "'>='", "'<>'", "'COUNT'", "'AVG'", "'MAX'", "'MIN'", "'SUM'", "'NULL'"
+  "'VARCHAR'", "'FLOAT'", "'AND'", "'.'", "'*'", "'WITH'", "'VACUUM'", "'='", 
+  "'<'", "'<='", "'>'", "'>='", "'<>'", "'COUNT'", "'AVG'", "'MAX'", "'MIN'", 
+  "'SUM'", "'NULL'"
 };
 
 std::vector<std::string> SQLParser::_symbolicNames = {
-  "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", 
-  "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "EqualOrAssign", 
-  "Less", "LessEqual", "Greater", "GreaterEqual", "NotEqual", "Count", "Average", 
-  "Max", "Min", "Sum", "Null", "Identifier", "Integer", "String", "Float", 
-  "Whitespace", "Annotation"
+  "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", 
+  "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", 
+  "EqualOrAssign", "Less", "LessEqual", "Greater", "GreaterEqual", "NotEqual", 
+  "Count", "Average", "Max", "Min", "Sum", "Null", "Identifier", "Integer", 
+  "String", "Float", "Whitespace", "Annotation"
 };
 
 dfa::Vocabulary SQLParser::_vocabulary(_literalNames, _symbolicNames);
@@ -1934,7 +2071,7 @@ SQLParser::Initializer::Initializer() {
 
   _serializedATN = {
     0x3, 0x608b, 0xa72a, 0x8133, 0xb9ed, 0x417c, 0x3be7, 0x7786, 0x5964, 
-    0x3, 0x35, 0x100, 0x4, 0x2, 0x9, 0x2, 0x4, 0x3, 0x9, 0x3, 0x4, 0x4, 
+    0x3, 0x37, 0x115, 0x4, 0x2, 0x9, 0x2, 0x4, 0x3, 0x9, 0x3, 0x4, 0x4, 
     0x9, 0x4, 0x4, 0x5, 0x9, 0x5, 0x4, 0x6, 0x9, 0x6, 0x4, 0x7, 0x9, 0x7, 
     0x4, 0x8, 0x9, 0x8, 0x4, 0x9, 0x9, 0x9, 0x4, 0xa, 0x9, 0xa, 0x4, 0xb, 
     0x9, 0xb, 0x4, 0xc, 0x9, 0xc, 0x4, 0xd, 0x9, 0xd, 0x4, 0xe, 0x9, 0xe, 
@@ -1973,133 +2110,147 @@ SQLParser::Initializer::Initializer() {
     0x3, 0x14, 0x3, 0x14, 0x3, 0x14, 0x3, 0x14, 0x3, 0x14, 0x3, 0x14, 0x5, 
     0x14, 0xf2, 0xa, 0x14, 0x3, 0x15, 0x3, 0x15, 0x3, 0x15, 0x7, 0x15, 0xf7, 
     0xa, 0x15, 0xc, 0x15, 0xe, 0x15, 0xfa, 0xb, 0x15, 0x3, 0x16, 0x3, 0x16, 
-    0x3, 0x17, 0x3, 0x17, 0x3, 0x17, 0x2, 0x2, 0x18, 0x2, 0x4, 0x6, 0x8, 
-    0xa, 0xc, 0xe, 0x10, 0x12, 0x14, 0x16, 0x18, 0x1a, 0x1c, 0x1e, 0x20, 
-    0x22, 0x24, 0x26, 0x28, 0x2a, 0x2c, 0x2, 0x5, 0x4, 0x2, 0x2f, 0x2f, 
-    0x31, 0x33, 0x3, 0x2, 0x24, 0x29, 0x3, 0x2, 0x2a, 0x2e, 0x2, 0x107, 
-    0x2, 0x31, 0x3, 0x2, 0x2, 0x2, 0x4, 0x43, 0x3, 0x2, 0x2, 0x2, 0x6, 0x49, 
-    0x3, 0x2, 0x2, 0x2, 0x8, 0x69, 0x3, 0x2, 0x2, 0x2, 0xa, 0x6b, 0x3, 0x2, 
-    0x2, 0x2, 0xc, 0x92, 0x3, 0x2, 0x2, 0x2, 0xe, 0x94, 0x3, 0x2, 0x2, 0x2, 
-    0x10, 0x9c, 0x3, 0x2, 0x2, 0x2, 0x12, 0xa5, 0x3, 0x2, 0x2, 0x2, 0x14, 
-    0xa7, 0x3, 0x2, 0x2, 0x2, 0x16, 0xaf, 0x3, 0x2, 0x2, 0x2, 0x18, 0xba, 
-    0x3, 0x2, 0x2, 0x2, 0x1a, 0xbc, 0x3, 0x2, 0x2, 0x2, 0x1c, 0xc4, 0x3, 
-    0x2, 0x2, 0x2, 0x1e, 0xc8, 0x3, 0x2, 0x2, 0x2, 0x20, 0xce, 0x3, 0x2, 
-    0x2, 0x2, 0x22, 0xd0, 0x3, 0x2, 0x2, 0x2, 0x24, 0xe5, 0x3, 0x2, 0x2, 
-    0x2, 0x26, 0xf1, 0x3, 0x2, 0x2, 0x2, 0x28, 0xf3, 0x3, 0x2, 0x2, 0x2, 
-    0x2a, 0xfb, 0x3, 0x2, 0x2, 0x2, 0x2c, 0xfd, 0x3, 0x2, 0x2, 0x2, 0x2e, 
-    0x30, 0x5, 0x4, 0x3, 0x2, 0x2f, 0x2e, 0x3, 0x2, 0x2, 0x2, 0x30, 0x33, 
-    0x3, 0x2, 0x2, 0x2, 0x31, 0x2f, 0x3, 0x2, 0x2, 0x2, 0x31, 0x32, 0x3, 
-    0x2, 0x2, 0x2, 0x32, 0x34, 0x3, 0x2, 0x2, 0x2, 0x33, 0x31, 0x3, 0x2, 
-    0x2, 0x2, 0x34, 0x35, 0x7, 0x2, 0x2, 0x3, 0x35, 0x3, 0x3, 0x2, 0x2, 
-    0x2, 0x36, 0x37, 0x5, 0x6, 0x4, 0x2, 0x37, 0x38, 0x7, 0x3, 0x2, 0x2, 
-    0x38, 0x44, 0x3, 0x2, 0x2, 0x2, 0x39, 0x3a, 0x5, 0x8, 0x5, 0x2, 0x3a, 
-    0x3b, 0x7, 0x3, 0x2, 0x2, 0x3b, 0x44, 0x3, 0x2, 0x2, 0x2, 0x3c, 0x3d, 
-    0x5, 0xc, 0x7, 0x2, 0x3d, 0x3e, 0x7, 0x3, 0x2, 0x2, 0x3e, 0x44, 0x3, 
-    0x2, 0x2, 0x2, 0x3f, 0x40, 0x7, 0x35, 0x2, 0x2, 0x40, 0x44, 0x7, 0x3, 
-    0x2, 0x2, 0x41, 0x42, 0x7, 0x2f, 0x2, 0x2, 0x42, 0x44, 0x7, 0x3, 0x2, 
-    0x2, 0x43, 0x36, 0x3, 0x2, 0x2, 0x2, 0x43, 0x39, 0x3, 0x2, 0x2, 0x2, 
-    0x43, 0x3c, 0x3, 0x2, 0x2, 0x2, 0x43, 0x3f, 0x3, 0x2, 0x2, 0x2, 0x43, 
-    0x41, 0x3, 0x2, 0x2, 0x2, 0x44, 0x5, 0x3, 0x2, 0x2, 0x2, 0x45, 0x46, 
-    0x7, 0x4, 0x2, 0x2, 0x46, 0x4a, 0x7, 0x5, 0x2, 0x2, 0x47, 0x48, 0x7, 
-    0x4, 0x2, 0x2, 0x48, 0x4a, 0x7, 0x6, 0x2, 0x2, 0x49, 0x45, 0x3, 0x2, 
-    0x2, 0x2, 0x49, 0x47, 0x3, 0x2, 0x2, 0x2, 0x4a, 0x7, 0x3, 0x2, 0x2, 
-    0x2, 0x4b, 0x4c, 0x7, 0x7, 0x2, 0x2, 0x4c, 0x4d, 0x7, 0x8, 0x2, 0x2, 
-    0x4d, 0x4e, 0x7, 0x30, 0x2, 0x2, 0x4e, 0x4f, 0x7, 0x9, 0x2, 0x2, 0x4f, 
-    0x50, 0x5, 0xe, 0x8, 0x2, 0x50, 0x51, 0x7, 0xa, 0x2, 0x2, 0x51, 0x6a, 
-    0x3, 0x2, 0x2, 0x2, 0x52, 0x53, 0x7, 0xb, 0x2, 0x2, 0x53, 0x54, 0x7, 
-    0x8, 0x2, 0x2, 0x54, 0x6a, 0x7, 0x30, 0x2, 0x2, 0x55, 0x56, 0x7, 0xc, 
-    0x2, 0x2, 0x56, 0x6a, 0x7, 0x30, 0x2, 0x2, 0x57, 0x58, 0x7, 0xd, 0x2, 
-    0x2, 0x58, 0x59, 0x7, 0xe, 0x2, 0x2, 0x59, 0x5a, 0x7, 0x30, 0x2, 0x2, 
-    0x5a, 0x5b, 0x7, 0xf, 0x2, 0x2, 0x5b, 0x6a, 0x5, 0x14, 0xb, 0x2, 0x5c, 
-    0x5d, 0x7, 0x10, 0x2, 0x2, 0x5d, 0x5e, 0x7, 0x11, 0x2, 0x2, 0x5e, 0x5f, 
-    0x7, 0x30, 0x2, 0x2, 0x5f, 0x60, 0x7, 0x12, 0x2, 0x2, 0x60, 0x6a, 0x5, 
-    0x1a, 0xe, 0x2, 0x61, 0x62, 0x7, 0x13, 0x2, 0x2, 0x62, 0x63, 0x7, 0x30, 
-    0x2, 0x2, 0x63, 0x64, 0x7, 0x14, 0x2, 0x2, 0x64, 0x65, 0x5, 0x22, 0x12, 
-    0x2, 0x65, 0x66, 0x7, 0x12, 0x2, 0x2, 0x66, 0x67, 0x5, 0x1a, 0xe, 0x2, 
-    0x67, 0x6a, 0x3, 0x2, 0x2, 0x2, 0x68, 0x6a, 0x5, 0xa, 0x6, 0x2, 0x69, 
-    0x4b, 0x3, 0x2, 0x2, 0x2, 0x69, 0x52, 0x3, 0x2, 0x2, 0x2, 0x69, 0x55, 
-    0x3, 0x2, 0x2, 0x2, 0x69, 0x57, 0x3, 0x2, 0x2, 0x2, 0x69, 0x5c, 0x3, 
-    0x2, 0x2, 0x2, 0x69, 0x61, 0x3, 0x2, 0x2, 0x2, 0x69, 0x68, 0x3, 0x2, 
-    0x2, 0x2, 0x6a, 0x9, 0x3, 0x2, 0x2, 0x2, 0x6b, 0x6c, 0x7, 0x15, 0x2, 
-    0x2, 0x6c, 0x6d, 0x5, 0x24, 0x13, 0x2, 0x6d, 0x6e, 0x7, 0x11, 0x2, 0x2, 
-    0x6e, 0x71, 0x5, 0x28, 0x15, 0x2, 0x6f, 0x70, 0x7, 0x12, 0x2, 0x2, 0x70, 
-    0x72, 0x5, 0x1a, 0xe, 0x2, 0x71, 0x6f, 0x3, 0x2, 0x2, 0x2, 0x71, 0x72, 
-    0x3, 0x2, 0x2, 0x2, 0x72, 0x76, 0x3, 0x2, 0x2, 0x2, 0x73, 0x74, 0x7, 
-    0x16, 0x2, 0x2, 0x74, 0x75, 0x7, 0x17, 0x2, 0x2, 0x75, 0x77, 0x5, 0x1e, 
-    0x10, 0x2, 0x76, 0x73, 0x3, 0x2, 0x2, 0x2, 0x76, 0x77, 0x3, 0x2, 0x2, 
-    0x2, 0x77, 0x7e, 0x3, 0x2, 0x2, 0x2, 0x78, 0x79, 0x7, 0x18, 0x2, 0x2, 
-    0x79, 0x7c, 0x7, 0x31, 0x2, 0x2, 0x7a, 0x7b, 0x7, 0x19, 0x2, 0x2, 0x7b, 
-    0x7d, 0x7, 0x31, 0x2, 0x2, 0x7c, 0x7a, 0x3, 0x2, 0x2, 0x2, 0x7c, 0x7d, 
-    0x3, 0x2, 0x2, 0x2, 0x7d, 0x7f, 0x3, 0x2, 0x2, 0x2, 0x7e, 0x78, 0x3, 
-    0x2, 0x2, 0x2, 0x7e, 0x7f, 0x3, 0x2, 0x2, 0x2, 0x7f, 0xb, 0x3, 0x2, 
-    0x2, 0x2, 0x80, 0x81, 0x7, 0x1a, 0x2, 0x2, 0x81, 0x82, 0x7, 0x8, 0x2, 
-    0x2, 0x82, 0x83, 0x7, 0x30, 0x2, 0x2, 0x83, 0x84, 0x7, 0x1b, 0x2, 0x2, 
-    0x84, 0x85, 0x7, 0x1c, 0x2, 0x2, 0x85, 0x86, 0x7, 0x9, 0x2, 0x2, 0x86, 
-    0x87, 0x5, 0x28, 0x15, 0x2, 0x87, 0x88, 0x7, 0xa, 0x2, 0x2, 0x88, 0x93, 
-    0x3, 0x2, 0x2, 0x2, 0x89, 0x8a, 0x7, 0x1a, 0x2, 0x2, 0x8a, 0x8b, 0x7, 
-    0x8, 0x2, 0x2, 0x8b, 0x8c, 0x7, 0x30, 0x2, 0x2, 0x8c, 0x8d, 0x7, 0xb, 
-    0x2, 0x2, 0x8d, 0x8e, 0x7, 0x1c, 0x2, 0x2, 0x8e, 0x8f, 0x7, 0x9, 0x2, 
-    0x2, 0x8f, 0x90, 0x5, 0x28, 0x15, 0x2, 0x90, 0x91, 0x7, 0xa, 0x2, 0x2, 
-    0x91, 0x93, 0x3, 0x2, 0x2, 0x2, 0x92, 0x80, 0x3, 0x2, 0x2, 0x2, 0x92, 
-    0x89, 0x3, 0x2, 0x2, 0x2, 0x93, 0xd, 0x3, 0x2, 0x2, 0x2, 0x94, 0x99, 
-    0x5, 0x10, 0x9, 0x2, 0x95, 0x96, 0x7, 0x1d, 0x2, 0x2, 0x96, 0x98, 0x5, 
-    0x10, 0x9, 0x2, 0x97, 0x95, 0x3, 0x2, 0x2, 0x2, 0x98, 0x9b, 0x3, 0x2, 
-    0x2, 0x2, 0x99, 0x97, 0x3, 0x2, 0x2, 0x2, 0x99, 0x9a, 0x3, 0x2, 0x2, 
-    0x2, 0x9a, 0xf, 0x3, 0x2, 0x2, 0x2, 0x9b, 0x99, 0x3, 0x2, 0x2, 0x2, 
-    0x9c, 0x9d, 0x7, 0x30, 0x2, 0x2, 0x9d, 0x9e, 0x5, 0x12, 0xa, 0x2, 0x9e, 
-    0x11, 0x3, 0x2, 0x2, 0x2, 0x9f, 0xa6, 0x7, 0x1e, 0x2, 0x2, 0xa0, 0xa1, 
-    0x7, 0x1f, 0x2, 0x2, 0xa1, 0xa2, 0x7, 0x9, 0x2, 0x2, 0xa2, 0xa3, 0x7, 
-    0x31, 0x2, 0x2, 0xa3, 0xa6, 0x7, 0xa, 0x2, 0x2, 0xa4, 0xa6, 0x7, 0x20, 
-    0x2, 0x2, 0xa5, 0x9f, 0x3, 0x2, 0x2, 0x2, 0xa5, 0xa0, 0x3, 0x2, 0x2, 
-    0x2, 0xa5, 0xa4, 0x3, 0x2, 0x2, 0x2, 0xa6, 0x13, 0x3, 0x2, 0x2, 0x2, 
-    0xa7, 0xac, 0x5, 0x16, 0xc, 0x2, 0xa8, 0xa9, 0x7, 0x1d, 0x2, 0x2, 0xa9, 
-    0xab, 0x5, 0x16, 0xc, 0x2, 0xaa, 0xa8, 0x3, 0x2, 0x2, 0x2, 0xab, 0xae, 
-    0x3, 0x2, 0x2, 0x2, 0xac, 0xaa, 0x3, 0x2, 0x2, 0x2, 0xac, 0xad, 0x3, 
-    0x2, 0x2, 0x2, 0xad, 0x15, 0x3, 0x2, 0x2, 0x2, 0xae, 0xac, 0x3, 0x2, 
-    0x2, 0x2, 0xaf, 0xb0, 0x7, 0x9, 0x2, 0x2, 0xb0, 0xb5, 0x5, 0x18, 0xd, 
-    0x2, 0xb1, 0xb2, 0x7, 0x1d, 0x2, 0x2, 0xb2, 0xb4, 0x5, 0x18, 0xd, 0x2, 
-    0xb3, 0xb1, 0x3, 0x2, 0x2, 0x2, 0xb4, 0xb7, 0x3, 0x2, 0x2, 0x2, 0xb5, 
-    0xb3, 0x3, 0x2, 0x2, 0x2, 0xb5, 0xb6, 0x3, 0x2, 0x2, 0x2, 0xb6, 0xb8, 
-    0x3, 0x2, 0x2, 0x2, 0xb7, 0xb5, 0x3, 0x2, 0x2, 0x2, 0xb8, 0xb9, 0x7, 
-    0xa, 0x2, 0x2, 0xb9, 0x17, 0x3, 0x2, 0x2, 0x2, 0xba, 0xbb, 0x9, 0x2, 
-    0x2, 0x2, 0xbb, 0x19, 0x3, 0x2, 0x2, 0x2, 0xbc, 0xc1, 0x5, 0x1c, 0xf, 
-    0x2, 0xbd, 0xbe, 0x7, 0x21, 0x2, 0x2, 0xbe, 0xc0, 0x5, 0x1c, 0xf, 0x2, 
-    0xbf, 0xbd, 0x3, 0x2, 0x2, 0x2, 0xc0, 0xc3, 0x3, 0x2, 0x2, 0x2, 0xc1, 
-    0xbf, 0x3, 0x2, 0x2, 0x2, 0xc1, 0xc2, 0x3, 0x2, 0x2, 0x2, 0xc2, 0x1b, 
-    0x3, 0x2, 0x2, 0x2, 0xc3, 0xc1, 0x3, 0x2, 0x2, 0x2, 0xc4, 0xc5, 0x5, 
-    0x1e, 0x10, 0x2, 0xc5, 0xc6, 0x5, 0x2a, 0x16, 0x2, 0xc6, 0xc7, 0x5, 
-    0x20, 0x11, 0x2, 0xc7, 0x1d, 0x3, 0x2, 0x2, 0x2, 0xc8, 0xc9, 0x7, 0x30, 
-    0x2, 0x2, 0xc9, 0xca, 0x7, 0x22, 0x2, 0x2, 0xca, 0xcb, 0x7, 0x30, 0x2, 
-    0x2, 0xcb, 0x1f, 0x3, 0x2, 0x2, 0x2, 0xcc, 0xcf, 0x5, 0x18, 0xd, 0x2, 
-    0xcd, 0xcf, 0x5, 0x1e, 0x10, 0x2, 0xce, 0xcc, 0x3, 0x2, 0x2, 0x2, 0xce, 
-    0xcd, 0x3, 0x2, 0x2, 0x2, 0xcf, 0x21, 0x3, 0x2, 0x2, 0x2, 0xd0, 0xd1, 
-    0x7, 0x30, 0x2, 0x2, 0xd1, 0xd2, 0x7, 0x24, 0x2, 0x2, 0xd2, 0xd9, 0x5, 
-    0x18, 0xd, 0x2, 0xd3, 0xd4, 0x7, 0x1d, 0x2, 0x2, 0xd4, 0xd5, 0x7, 0x30, 
-    0x2, 0x2, 0xd5, 0xd6, 0x7, 0x24, 0x2, 0x2, 0xd6, 0xd8, 0x5, 0x18, 0xd, 
-    0x2, 0xd7, 0xd3, 0x3, 0x2, 0x2, 0x2, 0xd8, 0xdb, 0x3, 0x2, 0x2, 0x2, 
-    0xd9, 0xd7, 0x3, 0x2, 0x2, 0x2, 0xd9, 0xda, 0x3, 0x2, 0x2, 0x2, 0xda, 
-    0x23, 0x3, 0x2, 0x2, 0x2, 0xdb, 0xd9, 0x3, 0x2, 0x2, 0x2, 0xdc, 0xe6, 
-    0x7, 0x23, 0x2, 0x2, 0xdd, 0xe2, 0x5, 0x26, 0x14, 0x2, 0xde, 0xdf, 0x7, 
-    0x1d, 0x2, 0x2, 0xdf, 0xe1, 0x5, 0x26, 0x14, 0x2, 0xe0, 0xde, 0x3, 0x2, 
-    0x2, 0x2, 0xe1, 0xe4, 0x3, 0x2, 0x2, 0x2, 0xe2, 0xe0, 0x3, 0x2, 0x2, 
-    0x2, 0xe2, 0xe3, 0x3, 0x2, 0x2, 0x2, 0xe3, 0xe6, 0x3, 0x2, 0x2, 0x2, 
-    0xe4, 0xe2, 0x3, 0x2, 0x2, 0x2, 0xe5, 0xdc, 0x3, 0x2, 0x2, 0x2, 0xe5, 
-    0xdd, 0x3, 0x2, 0x2, 0x2, 0xe6, 0x25, 0x3, 0x2, 0x2, 0x2, 0xe7, 0xf2, 
-    0x5, 0x1e, 0x10, 0x2, 0xe8, 0xe9, 0x5, 0x2c, 0x17, 0x2, 0xe9, 0xea, 
-    0x7, 0x9, 0x2, 0x2, 0xea, 0xeb, 0x5, 0x1e, 0x10, 0x2, 0xeb, 0xec, 0x7, 
-    0xa, 0x2, 0x2, 0xec, 0xf2, 0x3, 0x2, 0x2, 0x2, 0xed, 0xee, 0x7, 0x2a, 
-    0x2, 0x2, 0xee, 0xef, 0x7, 0x9, 0x2, 0x2, 0xef, 0xf0, 0x7, 0x23, 0x2, 
-    0x2, 0xf0, 0xf2, 0x7, 0xa, 0x2, 0x2, 0xf1, 0xe7, 0x3, 0x2, 0x2, 0x2, 
-    0xf1, 0xe8, 0x3, 0x2, 0x2, 0x2, 0xf1, 0xed, 0x3, 0x2, 0x2, 0x2, 0xf2, 
-    0x27, 0x3, 0x2, 0x2, 0x2, 0xf3, 0xf8, 0x7, 0x30, 0x2, 0x2, 0xf4, 0xf5, 
-    0x7, 0x1d, 0x2, 0x2, 0xf5, 0xf7, 0x7, 0x30, 0x2, 0x2, 0xf6, 0xf4, 0x3, 
-    0x2, 0x2, 0x2, 0xf7, 0xfa, 0x3, 0x2, 0x2, 0x2, 0xf8, 0xf6, 0x3, 0x2, 
-    0x2, 0x2, 0xf8, 0xf9, 0x3, 0x2, 0x2, 0x2, 0xf9, 0x29, 0x3, 0x2, 0x2, 
-    0x2, 0xfa, 0xf8, 0x3, 0x2, 0x2, 0x2, 0xfb, 0xfc, 0x9, 0x3, 0x2, 0x2, 
-    0xfc, 0x2b, 0x3, 0x2, 0x2, 0x2, 0xfd, 0xfe, 0x9, 0x4, 0x2, 0x2, 0xfe, 
-    0x2d, 0x3, 0x2, 0x2, 0x2, 0x16, 0x31, 0x43, 0x49, 0x69, 0x71, 0x76, 
-    0x7c, 0x7e, 0x92, 0x99, 0xa5, 0xac, 0xb5, 0xc1, 0xce, 0xd9, 0xe2, 0xe5, 
-    0xf1, 0xf8, 
+    0x3, 0x17, 0x3, 0x17, 0x3, 0x17, 0x4, 0x18, 0x9, 0x18, 0x5, 0x5, 0x105, 
+    0x3, 0x5, 0x3, 0x5, 0xa, 0x5, 0x3, 0x18, 0x3, 0x18, 0x3, 0x18, 0x3, 
+    0x18, 0x3, 0x18, 0x3, 0x18, 0x3, 0x18, 0x4, 0x19, 0x9, 0x19, 0x3, 0x3, 
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x19, 0x3, 0x19, 0x3, 0x19, 0x2, 0x2, 0x1a, 
+    0x2, 0x4, 0x6, 0x8, 0xa, 0xc, 0xe, 0x10, 0x12, 0x14, 0x16, 0x18, 0x1a, 
+    0x1c, 0x1e, 0x20, 0x22, 0x24, 0x26, 0x28, 0x2a, 0x2c, 0x100, 0x10d, 
+    0x2, 0x5, 0x4, 0x2, 0x31, 0x31, 0x33, 0x35, 0x3, 0x2, 0x26, 0x2b, 0x3, 
+    0x2, 0x2c, 0x30, 0x2, 0x11c, 0x2, 0x31, 0x3, 0x2, 0x2, 0x2, 0x4, 0x43, 
+    0x3, 0x2, 0x2, 0x2, 0x6, 0x49, 0x3, 0x2, 0x2, 0x2, 0x8, 0x69, 0x3, 0x2, 
+    0x2, 0x2, 0xa, 0x6b, 0x3, 0x2, 0x2, 0x2, 0xc, 0x92, 0x3, 0x2, 0x2, 0x2, 
+    0xe, 0x94, 0x3, 0x2, 0x2, 0x2, 0x10, 0x9c, 0x3, 0x2, 0x2, 0x2, 0x12, 
+    0xa5, 0x3, 0x2, 0x2, 0x2, 0x14, 0xa7, 0x3, 0x2, 0x2, 0x2, 0x16, 0xaf, 
+    0x3, 0x2, 0x2, 0x2, 0x18, 0xba, 0x3, 0x2, 0x2, 0x2, 0x1a, 0xbc, 0x3, 
+    0x2, 0x2, 0x2, 0x1c, 0xc4, 0x3, 0x2, 0x2, 0x2, 0x1e, 0xc8, 0x3, 0x2, 
+    0x2, 0x2, 0x20, 0xce, 0x3, 0x2, 0x2, 0x2, 0x22, 0xd0, 0x3, 0x2, 0x2, 
+    0x2, 0x24, 0xe5, 0x3, 0x2, 0x2, 0x2, 0x26, 0xf1, 0x3, 0x2, 0x2, 0x2, 
+    0x28, 0xf3, 0x3, 0x2, 0x2, 0x2, 0x2a, 0xfb, 0x3, 0x2, 0x2, 0x2, 0x2c, 
+    0xfd, 0x3, 0x2, 0x2, 0x2, 0x2e, 0x30, 0x5, 0x4, 0x3, 0x2, 0x2f, 0x2e, 
+    0x3, 0x2, 0x2, 0x2, 0x30, 0x33, 0x3, 0x2, 0x2, 0x2, 0x31, 0x2f, 0x3, 
+    0x2, 0x2, 0x2, 0x31, 0x32, 0x3, 0x2, 0x2, 0x2, 0x32, 0x34, 0x3, 0x2, 
+    0x2, 0x2, 0x33, 0x31, 0x3, 0x2, 0x2, 0x2, 0x34, 0x35, 0x7, 0x2, 0x2, 
+    0x3, 0x35, 0x3, 0x3, 0x2, 0x2, 0x2, 0x36, 0x37, 0x5, 0x6, 0x4, 0x2, 
+    0x37, 0x38, 0x7, 0x3, 0x2, 0x2, 0x38, 0x44, 0x3, 0x2, 0x2, 0x2, 0x39, 
+    0x3a, 0x5, 0x8, 0x5, 0x2, 0x3a, 0x3b, 0x7, 0x3, 0x2, 0x2, 0x3b, 0x44, 
+    0x3, 0x2, 0x2, 0x2, 0x3c, 0x3d, 0x5, 0xc, 0x7, 0x2, 0x3d, 0x3e, 0x7, 
+    0x3, 0x2, 0x2, 0x3e, 0x44, 0x3, 0x2, 0x2, 0x2, 0x3f, 0x40, 0x7, 0x37, 
+    0x2, 0x2, 0x40, 0x44, 0x7, 0x3, 0x2, 0x2, 0x41, 0x42, 0x7, 0x31, 0x2, 
+    0x2, 0x42, 0x44, 0x7, 0x3, 0x2, 0x2, 0x43, 0x36, 0x3, 0x2, 0x2, 0x2, 
+    0x43, 0x39, 0x3, 0x2, 0x2, 0x2, 0x43, 0x3c, 0x3, 0x2, 0x2, 0x2, 0x43, 
+    0x3f, 0x3, 0x2, 0x2, 0x2, 0x43, 0x41, 0x3, 0x2, 0x2, 0x2, 0x43, 0x10f, 
+    0x3, 0x2, 0x2, 0x2, 0x44, 0x5, 0x3, 0x2, 0x2, 0x2, 0x45, 0x46, 0x7, 
+    0x4, 0x2, 0x2, 0x46, 0x4a, 0x7, 0x5, 0x2, 0x2, 0x47, 0x48, 0x7, 0x4, 
+    0x2, 0x2, 0x48, 0x4a, 0x7, 0x6, 0x2, 0x2, 0x49, 0x45, 0x3, 0x2, 0x2, 
+    0x2, 0x49, 0x47, 0x3, 0x2, 0x2, 0x2, 0x4a, 0x7, 0x3, 0x2, 0x2, 0x2, 
+    0x4b, 0x4c, 0x7, 0x7, 0x2, 0x2, 0x4c, 0x4d, 0x7, 0x8, 0x2, 0x2, 0x4d, 
+    0x4e, 0x7, 0x32, 0x2, 0x2, 0x4e, 0x4f, 0x7, 0x9, 0x2, 0x2, 0x4f, 0x50, 
+    0x5, 0xe, 0x8, 0x2, 0x50, 0x51, 0x7, 0xa, 0x2, 0x2, 0x51, 0x102, 0x3, 
+    0x2, 0x2, 0x2, 0x52, 0x53, 0x7, 0xb, 0x2, 0x2, 0x53, 0x54, 0x7, 0x8, 
+    0x2, 0x2, 0x54, 0x6a, 0x7, 0x32, 0x2, 0x2, 0x55, 0x56, 0x7, 0xc, 0x2, 
+    0x2, 0x56, 0x6a, 0x7, 0x32, 0x2, 0x2, 0x57, 0x58, 0x7, 0xd, 0x2, 0x2, 
+    0x58, 0x59, 0x7, 0xe, 0x2, 0x2, 0x59, 0x5a, 0x7, 0x32, 0x2, 0x2, 0x5a, 
+    0x5b, 0x7, 0xf, 0x2, 0x2, 0x5b, 0x6a, 0x5, 0x14, 0xb, 0x2, 0x5c, 0x5d, 
+    0x7, 0x10, 0x2, 0x2, 0x5d, 0x5e, 0x7, 0x11, 0x2, 0x2, 0x5e, 0x5f, 0x7, 
+    0x32, 0x2, 0x2, 0x5f, 0x60, 0x7, 0x12, 0x2, 0x2, 0x60, 0x6a, 0x5, 0x1a, 
+    0xe, 0x2, 0x61, 0x62, 0x7, 0x13, 0x2, 0x2, 0x62, 0x63, 0x7, 0x32, 0x2, 
+    0x2, 0x63, 0x64, 0x7, 0x14, 0x2, 0x2, 0x64, 0x65, 0x5, 0x22, 0x12, 0x2, 
+    0x65, 0x66, 0x7, 0x12, 0x2, 0x2, 0x66, 0x67, 0x5, 0x1a, 0xe, 0x2, 0x67, 
+    0x6a, 0x3, 0x2, 0x2, 0x2, 0x68, 0x6a, 0x5, 0xa, 0x6, 0x2, 0x69, 0x4b, 
+    0x3, 0x2, 0x2, 0x2, 0x69, 0x52, 0x3, 0x2, 0x2, 0x2, 0x69, 0x55, 0x3, 
+    0x2, 0x2, 0x2, 0x69, 0x57, 0x3, 0x2, 0x2, 0x2, 0x69, 0x5c, 0x3, 0x2, 
+    0x2, 0x2, 0x69, 0x61, 0x3, 0x2, 0x2, 0x2, 0x69, 0x68, 0x3, 0x2, 0x2, 
+    0x2, 0x6a, 0x9, 0x3, 0x2, 0x2, 0x2, 0x6b, 0x6c, 0x7, 0x15, 0x2, 0x2, 
+    0x6c, 0x6d, 0x5, 0x24, 0x13, 0x2, 0x6d, 0x6e, 0x7, 0x11, 0x2, 0x2, 0x6e, 
+    0x71, 0x5, 0x28, 0x15, 0x2, 0x6f, 0x70, 0x7, 0x12, 0x2, 0x2, 0x70, 0x72, 
+    0x5, 0x1a, 0xe, 0x2, 0x71, 0x6f, 0x3, 0x2, 0x2, 0x2, 0x71, 0x72, 0x3, 
+    0x2, 0x2, 0x2, 0x72, 0x76, 0x3, 0x2, 0x2, 0x2, 0x73, 0x74, 0x7, 0x16, 
+    0x2, 0x2, 0x74, 0x75, 0x7, 0x17, 0x2, 0x2, 0x75, 0x77, 0x5, 0x1e, 0x10, 
+    0x2, 0x76, 0x73, 0x3, 0x2, 0x2, 0x2, 0x76, 0x77, 0x3, 0x2, 0x2, 0x2, 
+    0x77, 0x7e, 0x3, 0x2, 0x2, 0x2, 0x78, 0x79, 0x7, 0x18, 0x2, 0x2, 0x79, 
+    0x7c, 0x7, 0x33, 0x2, 0x2, 0x7a, 0x7b, 0x7, 0x19, 0x2, 0x2, 0x7b, 0x7d, 
+    0x7, 0x33, 0x2, 0x2, 0x7c, 0x7a, 0x3, 0x2, 0x2, 0x2, 0x7c, 0x7d, 0x3, 
+    0x2, 0x2, 0x2, 0x7d, 0x7f, 0x3, 0x2, 0x2, 0x2, 0x7e, 0x78, 0x3, 0x2, 
+    0x2, 0x2, 0x7e, 0x7f, 0x3, 0x2, 0x2, 0x2, 0x7f, 0xb, 0x3, 0x2, 0x2, 
+    0x2, 0x80, 0x81, 0x7, 0x1a, 0x2, 0x2, 0x81, 0x82, 0x7, 0x8, 0x2, 0x2, 
+    0x82, 0x83, 0x7, 0x32, 0x2, 0x2, 0x83, 0x84, 0x7, 0x1b, 0x2, 0x2, 0x84, 
+    0x85, 0x7, 0x1c, 0x2, 0x2, 0x85, 0x86, 0x7, 0x9, 0x2, 0x2, 0x86, 0x87, 
+    0x5, 0x28, 0x15, 0x2, 0x87, 0x88, 0x7, 0xa, 0x2, 0x2, 0x88, 0x93, 0x3, 
+    0x2, 0x2, 0x2, 0x89, 0x8a, 0x7, 0x1a, 0x2, 0x2, 0x8a, 0x8b, 0x7, 0x8, 
+    0x2, 0x2, 0x8b, 0x8c, 0x7, 0x32, 0x2, 0x2, 0x8c, 0x8d, 0x7, 0xb, 0x2, 
+    0x2, 0x8d, 0x8e, 0x7, 0x1c, 0x2, 0x2, 0x8e, 0x8f, 0x7, 0x9, 0x2, 0x2, 
+    0x8f, 0x90, 0x5, 0x28, 0x15, 0x2, 0x90, 0x91, 0x7, 0xa, 0x2, 0x2, 0x91, 
+    0x93, 0x3, 0x2, 0x2, 0x2, 0x92, 0x80, 0x3, 0x2, 0x2, 0x2, 0x92, 0x89, 
+    0x3, 0x2, 0x2, 0x2, 0x93, 0xd, 0x3, 0x2, 0x2, 0x2, 0x94, 0x99, 0x5, 
+    0x10, 0x9, 0x2, 0x95, 0x96, 0x7, 0x1d, 0x2, 0x2, 0x96, 0x98, 0x5, 0x10, 
+    0x9, 0x2, 0x97, 0x95, 0x3, 0x2, 0x2, 0x2, 0x98, 0x9b, 0x3, 0x2, 0x2, 
+    0x2, 0x99, 0x97, 0x3, 0x2, 0x2, 0x2, 0x99, 0x9a, 0x3, 0x2, 0x2, 0x2, 
+    0x9a, 0xf, 0x3, 0x2, 0x2, 0x2, 0x9b, 0x99, 0x3, 0x2, 0x2, 0x2, 0x9c, 
+    0x9d, 0x7, 0x32, 0x2, 0x2, 0x9d, 0x9e, 0x5, 0x12, 0xa, 0x2, 0x9e, 0x11, 
+    0x3, 0x2, 0x2, 0x2, 0x9f, 0xa6, 0x7, 0x1e, 0x2, 0x2, 0xa0, 0xa1, 0x7, 
+    0x1f, 0x2, 0x2, 0xa1, 0xa2, 0x7, 0x9, 0x2, 0x2, 0xa2, 0xa3, 0x7, 0x33, 
+    0x2, 0x2, 0xa3, 0xa6, 0x7, 0xa, 0x2, 0x2, 0xa4, 0xa6, 0x7, 0x20, 0x2, 
+    0x2, 0xa5, 0x9f, 0x3, 0x2, 0x2, 0x2, 0xa5, 0xa0, 0x3, 0x2, 0x2, 0x2, 
+    0xa5, 0xa4, 0x3, 0x2, 0x2, 0x2, 0xa6, 0x13, 0x3, 0x2, 0x2, 0x2, 0xa7, 
+    0xac, 0x5, 0x16, 0xc, 0x2, 0xa8, 0xa9, 0x7, 0x1d, 0x2, 0x2, 0xa9, 0xab, 
+    0x5, 0x16, 0xc, 0x2, 0xaa, 0xa8, 0x3, 0x2, 0x2, 0x2, 0xab, 0xae, 0x3, 
+    0x2, 0x2, 0x2, 0xac, 0xaa, 0x3, 0x2, 0x2, 0x2, 0xac, 0xad, 0x3, 0x2, 
+    0x2, 0x2, 0xad, 0x15, 0x3, 0x2, 0x2, 0x2, 0xae, 0xac, 0x3, 0x2, 0x2, 
+    0x2, 0xaf, 0xb0, 0x7, 0x9, 0x2, 0x2, 0xb0, 0xb5, 0x5, 0x18, 0xd, 0x2, 
+    0xb1, 0xb2, 0x7, 0x1d, 0x2, 0x2, 0xb2, 0xb4, 0x5, 0x18, 0xd, 0x2, 0xb3, 
+    0xb1, 0x3, 0x2, 0x2, 0x2, 0xb4, 0xb7, 0x3, 0x2, 0x2, 0x2, 0xb5, 0xb3, 
+    0x3, 0x2, 0x2, 0x2, 0xb5, 0xb6, 0x3, 0x2, 0x2, 0x2, 0xb6, 0xb8, 0x3, 
+    0x2, 0x2, 0x2, 0xb7, 0xb5, 0x3, 0x2, 0x2, 0x2, 0xb8, 0xb9, 0x7, 0xa, 
+    0x2, 0x2, 0xb9, 0x17, 0x3, 0x2, 0x2, 0x2, 0xba, 0xbb, 0x9, 0x2, 0x2, 
+    0x2, 0xbb, 0x19, 0x3, 0x2, 0x2, 0x2, 0xbc, 0xc1, 0x5, 0x1c, 0xf, 0x2, 
+    0xbd, 0xbe, 0x7, 0x21, 0x2, 0x2, 0xbe, 0xc0, 0x5, 0x1c, 0xf, 0x2, 0xbf, 
+    0xbd, 0x3, 0x2, 0x2, 0x2, 0xc0, 0xc3, 0x3, 0x2, 0x2, 0x2, 0xc1, 0xbf, 
+    0x3, 0x2, 0x2, 0x2, 0xc1, 0xc2, 0x3, 0x2, 0x2, 0x2, 0xc2, 0x1b, 0x3, 
+    0x2, 0x2, 0x2, 0xc3, 0xc1, 0x3, 0x2, 0x2, 0x2, 0xc4, 0xc5, 0x5, 0x1e, 
+    0x10, 0x2, 0xc5, 0xc6, 0x5, 0x2a, 0x16, 0x2, 0xc6, 0xc7, 0x5, 0x20, 
+    0x11, 0x2, 0xc7, 0x1d, 0x3, 0x2, 0x2, 0x2, 0xc8, 0xc9, 0x7, 0x32, 0x2, 
+    0x2, 0xc9, 0xca, 0x7, 0x22, 0x2, 0x2, 0xca, 0xcb, 0x7, 0x32, 0x2, 0x2, 
+    0xcb, 0x1f, 0x3, 0x2, 0x2, 0x2, 0xcc, 0xcf, 0x5, 0x18, 0xd, 0x2, 0xcd, 
+    0xcf, 0x5, 0x1e, 0x10, 0x2, 0xce, 0xcc, 0x3, 0x2, 0x2, 0x2, 0xce, 0xcd, 
+    0x3, 0x2, 0x2, 0x2, 0xcf, 0x21, 0x3, 0x2, 0x2, 0x2, 0xd0, 0xd1, 0x7, 
+    0x32, 0x2, 0x2, 0xd1, 0xd2, 0x7, 0x26, 0x2, 0x2, 0xd2, 0xd9, 0x5, 0x18, 
+    0xd, 0x2, 0xd3, 0xd4, 0x7, 0x1d, 0x2, 0x2, 0xd4, 0xd5, 0x7, 0x32, 0x2, 
+    0x2, 0xd5, 0xd6, 0x7, 0x26, 0x2, 0x2, 0xd6, 0xd8, 0x5, 0x18, 0xd, 0x2, 
+    0xd7, 0xd3, 0x3, 0x2, 0x2, 0x2, 0xd8, 0xdb, 0x3, 0x2, 0x2, 0x2, 0xd9, 
+    0xd7, 0x3, 0x2, 0x2, 0x2, 0xd9, 0xda, 0x3, 0x2, 0x2, 0x2, 0xda, 0x23, 
+    0x3, 0x2, 0x2, 0x2, 0xdb, 0xd9, 0x3, 0x2, 0x2, 0x2, 0xdc, 0xe6, 0x7, 
+    0x23, 0x2, 0x2, 0xdd, 0xe2, 0x5, 0x26, 0x14, 0x2, 0xde, 0xdf, 0x7, 0x1d, 
+    0x2, 0x2, 0xdf, 0xe1, 0x5, 0x26, 0x14, 0x2, 0xe0, 0xde, 0x3, 0x2, 0x2, 
+    0x2, 0xe1, 0xe4, 0x3, 0x2, 0x2, 0x2, 0xe2, 0xe0, 0x3, 0x2, 0x2, 0x2, 
+    0xe2, 0xe3, 0x3, 0x2, 0x2, 0x2, 0xe3, 0xe6, 0x3, 0x2, 0x2, 0x2, 0xe4, 
+    0xe2, 0x3, 0x2, 0x2, 0x2, 0xe5, 0xdc, 0x3, 0x2, 0x2, 0x2, 0xe5, 0xdd, 
+    0x3, 0x2, 0x2, 0x2, 0xe6, 0x25, 0x3, 0x2, 0x2, 0x2, 0xe7, 0xf2, 0x5, 
+    0x1e, 0x10, 0x2, 0xe8, 0xe9, 0x5, 0x2c, 0x17, 0x2, 0xe9, 0xea, 0x7, 
+    0x9, 0x2, 0x2, 0xea, 0xeb, 0x5, 0x1e, 0x10, 0x2, 0xeb, 0xec, 0x7, 0xa, 
+    0x2, 0x2, 0xec, 0xf2, 0x3, 0x2, 0x2, 0x2, 0xed, 0xee, 0x7, 0x2c, 0x2, 
+    0x2, 0xee, 0xef, 0x7, 0x9, 0x2, 0x2, 0xef, 0xf0, 0x7, 0x23, 0x2, 0x2, 
+    0xf0, 0xf2, 0x7, 0xa, 0x2, 0x2, 0xf1, 0xe7, 0x3, 0x2, 0x2, 0x2, 0xf1, 
+    0xe8, 0x3, 0x2, 0x2, 0x2, 0xf1, 0xed, 0x3, 0x2, 0x2, 0x2, 0xf2, 0x27, 
+    0x3, 0x2, 0x2, 0x2, 0xf3, 0xf8, 0x7, 0x32, 0x2, 0x2, 0xf4, 0xf5, 0x7, 
+    0x1d, 0x2, 0x2, 0xf5, 0xf7, 0x7, 0x32, 0x2, 0x2, 0xf6, 0xf4, 0x3, 0x2, 
+    0x2, 0x2, 0xf7, 0xfa, 0x3, 0x2, 0x2, 0x2, 0xf8, 0xf6, 0x3, 0x2, 0x2, 
+    0x2, 0xf8, 0xf9, 0x3, 0x2, 0x2, 0x2, 0xf9, 0x29, 0x3, 0x2, 0x2, 0x2, 
+    0xfa, 0xf8, 0x3, 0x2, 0x2, 0x2, 0xfb, 0xfc, 0x9, 0x3, 0x2, 0x2, 0xfc, 
+    0x2b, 0x3, 0x2, 0x2, 0x2, 0xfd, 0xfe, 0x9, 0x4, 0x2, 0x2, 0xfe, 0x2d, 
+    0x3, 0x2, 0x2, 0x2, 0x100, 0x106, 0x3, 0x2, 0x2, 0x2, 0x102, 0x103, 
+    0x3, 0x2, 0x2, 0x2, 0x102, 0x105, 0x3, 0x2, 0x2, 0x2, 0x103, 0x104, 
+    0x5, 0x100, 0x18, 0x2, 0x104, 0x105, 0x3, 0x2, 0x2, 0x2, 0x105, 0x6a, 
+    0x3, 0x2, 0x2, 0x2, 0x106, 0x107, 0x7, 0x24, 0x2, 0x2, 0x107, 0x108, 
+    0x7, 0x9, 0x2, 0x2, 0x108, 0x109, 0x7, 0x32, 0x2, 0x2, 0x109, 0x10a, 
+    0x7, 0x26, 0x2, 0x2, 0x10a, 0x10b, 0x7, 0x32, 0x2, 0x2, 0x10b, 0x10c, 
+    0x7, 0xa, 0x2, 0x2, 0x10c, 0x101, 0x3, 0x2, 0x2, 0x2, 0x10d, 0x112, 
+    0x3, 0x2, 0x2, 0x2, 0x10f, 0x110, 0x5, 0x10d, 0x19, 0x2, 0x110, 0x111, 
+    0x7, 0x3, 0x2, 0x2, 0x111, 0x44, 0x3, 0x2, 0x2, 0x2, 0x112, 0x113, 0x7, 
+    0x25, 0x2, 0x2, 0x113, 0x114, 0x7, 0x32, 0x2, 0x2, 0x114, 0x10e, 0x3, 
+    0x2, 0x2, 0x2, 0x17, 0x31, 0x43, 0x49, 0x69, 0x71, 0x76, 0x7c, 0x7e, 
+    0x92, 0x99, 0xa5, 0xac, 0xb5, 0xc1, 0xce, 0xd9, 0xe2, 0xe5, 0xf1, 0xf8, 
+    0x102, 
   };
 
   atn::ATNDeserializer deserializer;
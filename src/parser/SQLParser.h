@@ -13,23 +13,26 @@ class  SQLParser : public antlr4::Parser {
 public:
   enum {
     T__0 = 1, T__1 = 2, T__2 = 3, T__3 = 4, T__4 = 5, T__5 = 6, T__6 = 7, 
-    T__7 = 8, T__8 = 9, T__9 = 10, T__10 = 11, T__11 = 12, T__12 = 13, T__13 = 14, 
-    T__14 = 15, T__15 = 16, T__16 = 17, T__17 = 18, T__18 = 19, T__19 = 20, 
-    T__20 = 21, T__21 = 22, T__22 = 23, T__23 = 24, T__24 = 25, T__25 = 26, 
-    T__26 = 27, T__27 = 28, T__28 = 29, T__29 = 30, T__30 = 31, T__31 = 32, 
-    T__32 = 33, EqualOrAssign = 34, Less = 35, LessEqual = 36, Greater = 37, 
-    GreaterEqual = 38, NotEqual = 39, Count = 40, Average = 41, Max = 42, 
-    Min = 43, Sum = 44, Null = 45, Identifier = 46, Integer = 47, String = 48, 
-    Float = 49, Whitespace = 50, Annotation = 51
+    T__7 = 8, T__8 = 9, T__9 = 10, T__10 = 11, T__11 = 12, T__12 = 13, 
+    T__13 = 14, T__14 = 15, T__15 = 16, T__16 = 17, T__17 = 18, T__18 = 19, 
+    T__19 = 20, T__20 = 21, T__21 = 22, T__22 = 23, T__23 = 24, T__24 = 25, 
+    T__25 = 26, T__26 = 27, T__27 = 28, T__28 = 29, T__29 = 30, T__30 = 31, 
+    T__31 = 32, T__32 = 33, T__33 = 34, T__34 = 35, EqualOrAssign = 36, 
+    Less = 37, LessEqual = 38, Greater = 39, GreaterEqual = 40, NotEqual = 41, 
+    Count = 42, Average = 43, Max = 44, Min = 45, Sum = 46, Null = 47, 
+    Identifier = 48, Integer = 49, String = 50, Float = 51, Whitespace = 52, 
+    Annotation = 53
   };
 
   enum {
-    RuleProgram = 0, RuleStatement = 1, RuleDb_statement = 2, RuleTable_statement = 3, 
-    RuleSelect_table = 4, RuleIndex_statement = 5, RuleField_list = 6, RuleField = 7, 
-    RuleType_ = 8, RuleValue_lists = 9, RuleValue_list = 10, RuleValue = 11, 
-    RuleWhere_and_clause = 12, RuleWhere_clause = 13, RuleColumn = 14, RuleExpression = 15, 
-    RuleSet_clause = 16, RuleSelectors = 17, RuleSelector = 18, RuleIdentifiers = 19, 
-    RuleOperate = 20, RuleAggregator = 21
+    RuleProgram = 0, RuleStatement = 1, RuleDb_statement = 2, 
+    RuleTable_statement = 3, RuleSelect_table = 4, RuleIndex_statement = 5, 
+    RuleField_list = 6, RuleField = 7, RuleType_ = 8, RuleValue_lists = 9, 
+    RuleValue_list = 10, RuleValue = 11, RuleWhere_and_clause = 12, 
+    RuleWhere_clause = 13, RuleColumn = 14, RuleExpression = 15, 
+    RuleSet_clause = 16, RuleSelectors = 17, RuleSelector = 18, 
+    RuleIdentifiers = 19, RuleOperate = 20, RuleAggregator = 21, 
+    RuleTable_options = 22, RuleVacuum_statement = 23
   };
 
   SQLParser(antlr4::TokenStream *input);
@@ -63,7 +66,9 @@ public:
   class SelectorContext;
   class IdentifiersContext;
   class OperateContext;
-  class AggregatorContext; 
+  class AggregatorContext;
+  class Table_optionsContext;
+  class Vacuum_statementContext; 
 
   class  ProgramContext : public antlr4::ParserRuleContext {
   public:
@@ -88,6 +93,7 @@ public:
     Index_statementContext *index_statement();
     antlr4::tree::TerminalNode *Annotation();
     antlr4::tree::TerminalNode *Null();
+    Vacuum_statementContext *vacuum_statement();
 
     virtual antlrcpp::Any accept(antlr4::tree::ParseTreeVisitor *visitor) override;
    
@@ -161,6 +167,7 @@ public:
 
     antlr4::tree::TerminalNode *Identifier();
     Field_listContext *field_list();
+    Table_optionsContext *table_options();
     virtual antlrcpp::Any accept(antlr4::tree::ParseTreeVisitor *visitor) override;
   };
 
@@ -494,6 +501,32 @@ public:
 
   AggregatorContext* aggregator();
 
+  class  Table_optionsContext : public antlr4::ParserRuleContext {
+  public:
+    Table_optionsContext(antlr4::ParserRuleContext *parent, size_t invokingState);
+    virtual size_t getRuleIndex() const override;
+    std::vector<antlr4::tree::TerminalNode *> Identifier();
+    antlr4::tree::TerminalNode* Identifier(size_t i);
+    antlr4::tree::TerminalNode *EqualOrAssign();
+
+    virtual antlrcpp::Any accept(antlr4::tree::ParseTreeVisitor *visitor) override;
+   
+  };
+
+  Table_optionsContext* table_options();
+
+  class  Vacuum_statementContext : public antlr4::ParserRuleContext {
+  public:
+    Vacuum_statementContext(antlr4::ParserRuleContext *parent, size_t invokingState);
+    virtual size_t getRuleIndex() const override;
+    antlr4::tree::TerminalNode *Identifier();
+
+    virtual antlrcpp::Any accept(antlr4::tree::ParseTreeVisitor *visitor) override;
+   
+  };
+
+  Vacuum_statementContext* vacuum_statement();
+
 
 private:
   static std::vector<antlr4::dfa::DFA> _decisionToDFA;
@@ -79,6 +79,10 @@ public:
 
     virtual antlrcpp::Any visitAggregator(SQLParser::AggregatorContext *context) = 0;
 
+    virtual antlrcpp::Any visitTable_options(SQLParser::Table_optionsContext *context) = 0;
+
+    virtual antlrcpp::Any visitVacuum_statement(SQLParser::Vacuum_statementContext *context) = 0;
+
 
 };
 
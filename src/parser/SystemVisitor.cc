@@ -3,6 +3,8 @@
 #include <float.h>
 #include <stdlib.h>
 
+#include <set>
+
 #include "condition/conditions.h"
 #include "exception/exceptions.h"
 #include "record/fixed_record.h"
@@ -35,6 +37,8 @@ antlrcpp::Any SystemVisitor::visitStatement(SQLParser::StatementContext *ctx) {
     res = ctx->table_statement()->accept(this);
   else if (ctx->index_statement())
     res = ctx->index_statement()->accept(this);
+  else if (ctx->vacuum_statement())
+    res = ctx->vacuum_statement()->accept(this);
   else {
     printf("%s\n", ctx->getText().c_str());
     throw SpecialException();
@@ -71,6 +75,13 @@ antlrcpp::Any SystemVisitor::visitCreate_table(
   Size nSize = 0;
   try {
     Schema iSchema = ctx->field_list()->accept(this);
+    if (ctx->table_options()) {
+      TableLayout iLayout = ctx->table_options()->accept(this);
+      std::vector<Column> iColVec;
+      for (Size i = 0; i < iSchema.GetSize(); ++i)
+        iColVec.push_back(iSchema.GetColumn(i));
+      iSchema = Schema(iColVec, iLayout);
+    }
     String sTableName = ctx->Identifier()->getText();
     _pDB->CreateTable(sTableName, iSchema);
     nSize = 1;
@@ -84,6 +95,17 @@ antlrcpp::Any SystemVisitor::visitCreate_table(
   return res;
 }
 
+antlrcpp::Any SystemVisitor::visitTable_options(
+    SQLParser::Table_optionsContext *ctx) {
+  String sOption = ctx->Identifier(0)->getText();
+  String sValue = ctx->Identifier(1)->getText();
+  if (sOption != "layout")
+    throw ParserException("unknown table option " + sOption);
+  if (sValue == "row") return TableLayout::ROW;
+  if (sValue == "columnar") return TableLayout::COLUMNAR;
+  throw ParserException("unknown table layout " + sValue);
+}
+
 antlrcpp::Any SystemVisitor::visitDrop_table(
     SQLParser::Drop_tableContext *ctx) {
   Size nSize = 0;
@@ -132,6 +154,22 @@ antlrcpp::Any SystemVisitor::visitDescribe_table(
   return res;
 }
 
+antlrcpp::Any SystemVisitor::visitVacuum_statement(
+    SQLParser::Vacuum_statementContext *ctx) {
+  Size nSize = 0;
+  try {
+    String sTableName = ctx->Identifier()->getText();
+    nSize = _pDB->Vacuum(sTableName);
+  } catch (const std::exception &e) {
+    std::cerr << e.what() << '\n';
+  }
+  Result *res = new MemResult({"Vacuum"});
+  FixedRecord *pRes = new FixedRecord(1, {FieldType::INT_TYPE}, {4});
+  pRes->SetField(0, new IntField(nSize));
+  res->PushBack(pRes);
+  return res;
+}
+
 antlrcpp::Any SystemVisitor::visitDelete_from_table(
     SQLParser::Delete_from_tableContext *ctx) {
   String sTableName = ctx->Identifier()->getText();
@@ -210,9 +248,7 @@ antlrcpp::Any SystemVisitor::visitInsert_into_table(
   std::vector<std::vector<String>> iValueListVec =
       ctx->value_lists()->accept(this);
   String sTableName = ctx->Identifier()->getText();
-  for (const auto &iValueList : iValueListVec) {
-    _pDB->Insert(sTableName, iValueList);
-  }
+  _pDB->InsertMany(sTableName, iValueListVec);
   Result *res = new MemResult({"Insert"});
   FixedRecord *pRes = new FixedRecord(1, {FieldType::INT_TYPE}, {4});
   pRes->SetField(0, new IntField(iValueListVec.size()));
@@ -232,28 +268,33 @@ antlrcpp::Any SystemVisitor::visitSelect_table(
     iCondMap = iTempMap;
   }
 
+  // 单表查询直接取回扫描得到的记录，避免按位置再次读取解码
+  bool bJoin =
+      std::set<String>(iTableNameVec.begin(), iTableNameVec.end()).size() > 1;
+  std::vector<Record *> iRecordVec{};
   for (const auto &sTableName : iTableNameVec) {
-    if (iCondMap.find(sTableName) == iCondMap.end())
-      iResultMap[sTableName] = _pDB->Search(sTableName, nullptr, {});
-    else {
-      std::vector<Condition *> iIndexCond{};
-      std::vector<Condition *> iOtherCond{};
+    std::vector<Condition *> iIndexCond{};
+    std::vector<Condition *> iOtherCond{};
+    if (iCondMap.find(sTableName) != iCondMap.end()) {
       for (const auto &pCond : iCondMap[sTableName])
         if (pCond->GetType() == ConditionType::INDEX_TYPE)
           iIndexCond.push_back(pCond);
         else
           iOtherCond.push_back(pCond);
-      Condition *pCond = nullptr;
-      if (iOtherCond.size() > 0) pCond = new AndCondition(iOtherCond);
-      iResultMap[sTableName] = _pDB->Search(sTableName, pCond, iIndexCond);
-      if (pCond) delete pCond;
-      for (const auto &it : iIndexCond)
-        if (it) delete it;
     }
+    Condition *pCond = nullptr;
+    if (iOtherCond.size() > 0) pCond = new AndCondition(iOtherCond);
+    if (bJoin)
+      iResultMap[sTableName] = _pDB->Search(sTableName, pCond, iIndexCond);
+    else
+      iRecordVec = _pDB->Select(sTableName, pCond, iIndexCond);
+    if (pCond) delete pCond;
+    for (const auto &it : iIndexCond)
+      if (it) delete it;
+    if (!bJoin) break;
   }
 
   // TODO: Join
-  bool bJoin = (iResultMap.size() > 1);
   std::vector<Condition *> iJoinConds = {};
   if (iCondMap.find("JOIN") != iCondMap.end()) {
     iJoinConds = iCondMap.find("JOIN")->second;
@@ -262,13 +303,9 @@ antlrcpp::Any SystemVisitor::visitSelect_table(
   if (bJoin) iHeadDataPair = _pDB->Join(iResultMap, iJoinConds);
 
   // TODO: Generate Result
-  std::vector<PageSlotID> iData;
   if (!bJoin) {
-    String sTableName = iTableNameVec[0];
-    iData = iResultMap[sTableName];
-    Result *pResult = new MemResult(_pDB->GetColumnNames(sTableName));
-    for (const auto &it : iData)
-      pResult->PushBack(_pDB->GetRecord(iTableNameVec[0], it));
+    Result *pResult = new MemResult(_pDB->GetColumnNames(iTableNameVec[0]));
+    for (const auto &pRecord : iRecordVec) pResult->PushBack(pRecord);
     return pResult;
   } else {
     Result *pResult = new MemResult(iHeadDataPair.first);
@@ -14,6 +14,8 @@ class SystemVisitor : public SQLBaseVisitor {
   antlrcpp::Any visitShow_tables(SQLParser::Show_tablesContext *ctx) override;
   antlrcpp::Any visitShow_indexes(SQLParser::Show_indexesContext *ctx) override;
   antlrcpp::Any visitCreate_table(SQLParser::Create_tableContext *ctx) override;
+  antlrcpp::Any visitTable_options(
+      SQLParser::Table_optionsContext *ctx) override;
   antlrcpp::Any visitDrop_table(SQLParser::Drop_tableContext *ctx) override;
   antlrcpp::Any visitInsert_into_table(
       SQLParser::Insert_into_tableContext *ctx) override;
@@ -23,6 +25,8 @@ class SystemVisitor : public SQLBaseVisitor {
   antlrcpp::Any visitSelect_table(SQLParser::Select_tableContext *ctx) override;
   antlrcpp::Any visitDescribe_table(
       SQLParser::Describe_tableContext *ctx) override;
+  antlrcpp::Any visitVacuum_statement(
+      SQLParser::Vacuum_statementContext *ctx) override;
 
   antlrcpp::Any visitField_list(SQLParser::Field_listContext *ctx) override;
   antlrcpp::Any visitNormal_field(SQLParser::Normal_fieldContext *ctx) override;
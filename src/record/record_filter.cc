@@ -0,0 +1,242 @@
+#include "record/record_filter.h"
+
+#include <assert.h>
+
+#include <cmath>
+#include <cstring>
+
+#include "record/toast_pointer.h"
+
+namespace thdb {
+
+RecordFilter::RecordFilter(const std::vector<FieldType> &iTypeVec,
+                           const std::vector<Size> &iSizeVec)
+    : _iTypeVec(iTypeVec),
+      _iFixedBefore(iTypeVec.size()),
+      _iStrBefore(iTypeVec.size()) {
+  assert(iTypeVec.size() == iSizeVec.size());
+  Size nFixed = 0, nStr = 0;
+  for (FieldID i = 0; i < iTypeVec.size(); ++i) {
+    _iFixedBefore[i] = nFixed;
+    _iStrBefore[i] = nStr;
+    if (iTypeVec[i] == FieldType::STRING_TYPE)
+      ++nStr;
+    else if (iTypeVec[i] != FieldType::NONE_TYPE)
+      nFixed += iSizeVec[i];
+  }
+}
+
+bool RecordFilter::AddRange(FieldID nPos, double fMin, double fMax) {
+  Instr iInstr{};
+  iInstr.nPos = nPos;
+  iInstr.nLen = 1;
+  if (_iTypeVec[nPos] == FieldType::NONE_TYPE) {
+    iInstr.iOp = FilterOp::CONST_FALSE;
+  } else if (_iTypeVec[nPos] == FieldType::INT_TYPE) {
+    iInstr.iOp = FilterOp::INT_RANGE;
+    iInstr.nMin = (fMin < INT32_MIN) ? INT32_MIN : (ceil(fMin));
+    iInstr.nMax = (fMax > INT32_MAX) ? INT32_MAX : (ceil(fMax));
+  } else if (_iTypeVec[nPos] == FieldType::FLOAT_TYPE) {
+    iInstr.iOp = FilterOp::FLOAT_RANGE;
+    iInstr.fMin = fMin;
+    iInstr.fMax = fMax;
+  } else {
+    return false;
+  }
+  _iProgram.push_back(iInstr);
+  return true;
+}
+
+void RecordFilter::AddConst(bool bValue) {
+  Instr iInstr{};
+  iInstr.iOp = bValue ? FilterOp::CONST_TRUE : FilterOp::CONST_FALSE;
+  iInstr.nLen = 1;
+  _iProgram.push_back(iInstr);
+}
+
+Size RecordFilter::Begin(FilterOp iOp) {
+  assert(iOp == FilterOp::AND || iOp == FilterOp::OR || iOp == FilterOp::NOT);
+  Instr iInstr{};
+  iInstr.iOp = iOp;
+  _iProgram.push_back(iInstr);
+  return _iProgram.size() - 1;
+}
+
+void RecordFilter::End(Size nBegin) {
+  _iProgram[nBegin].nLen = _iProgram.size() - nBegin;
+}
+
+bool RecordFilter::Match(const uint8_t *pData) const {
+  if (_iProgram.empty()) return true;
+  Size nCur = 0;
+  return Eval(pData, nCur);
+}
+
+const uint8_t *RecordFilter::GetFieldData(const uint8_t *pData,
+                                          FieldID nPos) const {
+  PageOffset nStrNum;
+  memcpy(&nStrNum, pData, sizeof(PageOffset));
+  Size nOffset =
+      sizeof(PageOffset) * (1 + nStrNum) + _iFixedBefore[nPos];
+  const uint8_t *pStrLen = pData + sizeof(PageOffset);
+  for (Size i = 0; i < _iStrBefore[nPos]; ++i) {
+    PageOffset nLen;
+    memcpy(&nLen, pStrLen + i * sizeof(PageOffset), sizeof(PageOffset));
+    nOffset += nLen & ~EXTERNAL_FLAG;
+  }
+  return pData + nOffset;
+}
+
+void RecordFilter::MatchColumns(const std::vector<const uint8_t *> &iColumns,
+                                Size nCount, uint8_t *pResult) const {
+  if (_iProgram.empty()) {
+    memset(pResult, 1, nCount);
+    return;
+  }
+  Size nCur = 0;
+  EvalColumns(iColumns, nCount, nCur, pResult);
+}
+
+void RecordFilter::EvalColumns(const std::vector<const uint8_t *> &iColumns,
+                               Size nCount, Size &nCur,
+                               uint8_t *pResult) const {
+  const Instr &iInstr = _iProgram[nCur];
+  Size nEnd = nCur + iInstr.nLen;
+  ++nCur;
+  switch (iInstr.iOp) {
+    case FilterOp::CONST_TRUE:
+    case FilterOp::CONST_FALSE:
+      memset(pResult, iInstr.iOp == FilterOp::CONST_TRUE, nCount);
+      return;
+    case FilterOp::INT_RANGE: {
+      const uint8_t *pColumn = iColumns[iInstr.nPos];
+      int nMin = iInstr.nMin, nMax = iInstr.nMax;
+      for (Size i = 0; i < nCount; ++i) {
+        int nData;
+        memcpy(&nData, pColumn + i * sizeof(int), sizeof(int));
+        pResult[i] = (nData >= nMin) & (nData < nMax);
+      }
+      return;
+    }
+    case FilterOp::FLOAT_RANGE: {
+      const uint8_t *pColumn = iColumns[iInstr.nPos];
+      double fMin = iInstr.fMin, fMax = iInstr.fMax;
+      for (Size i = 0; i < nCount; ++i) {
+        double fData;
+        memcpy(&fData, pColumn + i * sizeof(double), sizeof(double));
+        pResult[i] = (fData >= fMin) & (fData < fMax);
+      }
+      return;
+    }
+    case FilterOp::NOT:
+      EvalColumns(iColumns, nCount, nCur, pResult);
+      for (Size i = 0; i < nCount; ++i) pResult[i] ^= 1;
+      return;
+    case FilterOp::AND:
+    case FilterOp::OR: {
+      // 子条件逐个求值后按位合并，列式求值不做短路
+      bool bAnd = (iInstr.iOp == FilterOp::AND);
+      memset(pResult, bAnd, nCount);
+      std::vector<uint8_t> iChild(nCount);
+      while (nCur < nEnd) {
+        EvalColumns(iColumns, nCount, nCur, iChild.data());
+        if (bAnd) {
+          for (Size i = 0; i < nCount; ++i) pResult[i] &= iChild[i];
+        } else {
+          for (Size i = 0; i < nCount; ++i) pResult[i] |= iChild[i];
+        }
+      }
+      return;
+    }
+  }
+}
+
+bool RecordFilter::Eval(const uint8_t *pData, Size &nCur) const {
+  const Instr &iInstr = _iProgram[nCur];
+  Size nEnd = nCur + iInstr.nLen;
+  ++nCur;
+  switch (iInstr.iOp) {
+    case FilterOp::CONST_TRUE:
+      return true;
+    case FilterOp::CONST_FALSE:
+      return false;
+    case FilterOp::INT_RANGE: {
+      int nData;
+      memcpy(&nData, GetFieldData(pData, iInstr.nPos), sizeof(int));
+      return (nData >= iInstr.nMin) && (nData < iInstr.nMax);
+    }
+    case FilterOp::FLOAT_RANGE: {
+      double fData;
+      memcpy(&fData, GetFieldData(pData, iInstr.nPos), sizeof(double));
+      return (fData >= iInstr.fMin) && (fData < iInstr.fMax);
+    }
+    case FilterOp::NOT:
+      return !Eval(pData, nCur);
+    case FilterOp::AND:
+    case FilterOp::OR: {
+      // 短路求值，结果确定后直接跳过剩余的子条件
+      bool bShort = (iInstr.iOp == FilterOp::OR);
+      while (nCur < nEnd) {
+        if (Eval(pData, nCur) == bShort) {
+          nCur = nEnd;
+          return bShort;
+        }
+      }
+      return !bShort;
+    }
+  }
+  return false;
+}
+
+bool RecordFilter::MayMatch(const RangeProbe &iProbe) const {
+  if (_iProgram.empty()) return true;
+  Size nCur = 0;
+  bool bMust = false;
+  return EvalProbe(iProbe, nCur, bMust);
+}
+
+bool RecordFilter::EvalProbe(const RangeProbe &iProbe, Size &nCur,
+                             bool &bMust) const {
+  const Instr &iInstr = _iProgram[nCur];
+  Size nEnd = nCur + iInstr.nLen;
+  ++nCur;
+  switch (iInstr.iOp) {
+    case FilterOp::CONST_TRUE:
+    case FilterOp::CONST_FALSE:
+      bMust = (iInstr.iOp == FilterOp::CONST_TRUE);
+      return bMust;
+    case FilterOp::INT_RANGE:
+      return iProbe.MayInRange(iInstr.nPos, iInstr.nMin, iInstr.nMax, true,
+                               bMust);
+    case FilterOp::FLOAT_RANGE:
+      return iProbe.MayInRange(iInstr.nPos, iInstr.fMin, iInstr.fMax, false,
+                               bMust);
+    case FilterOp::NOT: {
+      bool bChildMust = false;
+      bool bChildMay = EvalProbe(iProbe, nCur, bChildMust);
+      bMust = !bChildMay;
+      return !bChildMust;
+    }
+    case FilterOp::AND:
+    case FilterOp::OR: {
+      bool bAnd = (iInstr.iOp == FilterOp::AND);
+      bool bMay = bAnd;
+      bMust = bAnd;
+      while (nCur < nEnd) {
+        bool bChildMust = false;
+        bool bChildMay = EvalProbe(iProbe, nCur, bChildMust);
+        if (bAnd) {
+          bMay = bMay && bChildMay;
+          bMust = bMust && bChildMust;
+        } else {
+          bMay = bMay || bChildMay;
+          bMust = bMust || bChildMust;
+        }
+      }
+      return bMay;
+    }
+  }
+  return true;
+}
+
+}  // namespace thdb
@@ -0,0 +1,125 @@
+#ifndef THDB_RECORD_FILTER_H_
+#define THDB_RECORD_FILTER_H_
+
+#include "defines.h"
+#include "field/field.h"
+
+namespace thdb {
+
+enum class FilterOp {
+  CONST_TRUE = 0,
+  CONST_FALSE = 1,
+  INT_RANGE = 2,
+  FLOAT_RANGE = 3,
+  AND = 4,
+  OR = 5,
+  NOT = 6
+};
+
+/**
+ * @brief 一组记录的概要，例如一个数据页面的取值范围或布隆过滤器，
+ * 用于在不读取记录的情况下判断范围条件。
+ */
+class RangeProbe {
+ public:
+  virtual ~RangeProbe() = default;
+  /**
+   * @brief 判断这组记录中第nPos列是否可能有值落在[fLow, fHigh)中
+   *
+   * @param bInt 范围是否已经取整为整数列的范围
+   * @param bMust 这组记录是否全部落在范围中，无法确定时为false
+   */
+  virtual bool MayInRange(FieldID nPos, double fLow, double fHigh, bool bInt,
+                          bool &bMust) const = 0;
+};
+
+/**
+ * @brief 编译后的字节级记录过滤器。
+ * 检索条件按前序编译为指令序列，直接在变长记录的序列化数据上求值，
+ * 只读取条件涉及的列，不解码记录也不分配内存。
+ * 每列的偏移由表结构预先计算，求值时只需累加其前方字符串列的长度。
+ */
+class RecordFilter {
+ public:
+  RecordFilter(const std::vector<FieldType> &iTypeVec,
+               const std::vector<Size> &iSizeVec);
+  ~RecordFilter() = default;
+
+  /**
+   * @brief 添加一个范围判断，左闭右开，语义与RangeCondition一致
+   *
+   * @return false 该列的类型无法在字节上判断
+   */
+  bool AddRange(FieldID nPos, double fMin, double fMax);
+  void AddConst(bool bValue);
+  /**
+   * @brief 开始一个AND/OR/NOT复合条件，之后添加的指令为其子条件
+   *
+   * @return Size 复合条件指令的位置，用于End
+   */
+  Size Begin(FilterOp iOp);
+  /**
+   * @brief 结束一个复合条件
+   *
+   * @param nBegin Begin返回的位置
+   */
+  void End(Size nBegin);
+
+  /**
+   * @brief 判断一条序列化记录是否满足条件
+   *
+   * @param pData VariableRecord::VarStore格式的记录数据
+   */
+  bool Match(const uint8_t *pData) const;
+  /**
+   * @brief 在按列存放的一批记录上求值。
+   * 每条指令对整列做一次无分支的循环，便于编译器向量化，且只读取条件涉及的列。
+   *
+   * @param iColumns 各列数据的起始地址，每列的值按表结构中的长度连续存放
+   * @param nCount 记录条数
+   * @param pResult 各条记录的结果，满足条件为1，否则为0
+   */
+  void MatchColumns(const std::vector<const uint8_t *> &iColumns, Size nCount,
+                    uint8_t *pResult) const;
+  /**
+   * @brief 根据一组记录的概要判断其中是否可能有满足条件的记录。
+   * 结果是保守的，返回false时一定没有满足条件的记录。
+   */
+  bool MayMatch(const RangeProbe &iProbe) const;
+
+ private:
+  struct Instr {
+    FilterOp iOp;
+    FieldID nPos;
+    /**
+     * @brief 包括自身在内的子树指令数
+     */
+    Size nLen;
+    int nMin, nMax;
+    double fMin, fMax;
+  };
+
+  bool Eval(const uint8_t *pData, Size &nCur) const;
+  const uint8_t *GetFieldData(const uint8_t *pData, FieldID nPos) const;
+  void EvalColumns(const std::vector<const uint8_t *> &iColumns, Size nCount,
+                   Size &nCur, uint8_t *pResult) const;
+  /**
+   * @brief 在概要上求值，返回是否可能满足，bMust表示是否所有记录都满足
+   */
+  bool EvalProbe(const RangeProbe &iProbe, Size &nCur, bool &bMust) const;
+
+  std::vector<FieldType> _iTypeVec;
+  /**
+   * @brief 各列之前定长列的总长度
+   */
+  std::vector<Size> _iFixedBefore;
+  /**
+   * @brief 各列之前字符串列的数量
+   */
+  std::vector<Size> _iStrBefore;
+  std::vector<Instr> _iProgram;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_RECORD_FILTER_H_
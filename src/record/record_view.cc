@@ -0,0 +1,97 @@
+#include "record/record_view.h"
+
+#include <assert.h>
+
+#include <cstring>
+
+#include "record/variable_record.h"
+
+namespace thdb {
+
+RecordView::RecordView(const std::vector<FieldType> &iTypeVec,
+                       const std::vector<Size> &iSizeVec)
+    : _iTypeVec(iTypeVec),
+      _iSizeVec(iSizeVec),
+      _pData(nullptr),
+      _iOffsetVec(iTypeVec.size()),
+      _iLenVec(iTypeVec.size()),
+      _iExternalVec(iTypeVec.size()) {
+  assert(_iTypeVec.size() == _iSizeVec.size());
+}
+
+void RecordView::Reset(const uint8_t *pData) {
+  _pData = pData;
+  PageOffset nStrNum;
+  memcpy(&nStrNum, pData, sizeof(PageOffset));
+  const uint8_t *pStrLen = pData + sizeof(PageOffset);
+  PageOffset nOffset = sizeof(PageOffset) * (1 + nStrNum);
+  for (FieldID i = 0; i < _iTypeVec.size(); ++i) {
+    PageOffset nLen = 0;
+    _iExternalVec[i] = false;
+    if (_iTypeVec[i] == FieldType::STRING_TYPE) {
+      memcpy(&nLen, pStrLen, sizeof(PageOffset));
+      pStrLen += sizeof(PageOffset);
+      _iExternalVec[i] = (nLen & EXTERNAL_FLAG) != 0;
+      nLen &= ~EXTERNAL_FLAG;
+    } else if (_iTypeVec[i] != FieldType::NONE_TYPE) {
+      nLen = _iSizeVec[i];
+    }
+    _iOffsetVec[i] = nOffset;
+    _iLenVec[i] = nLen;
+    nOffset += nLen;
+  }
+}
+
+const uint8_t *RecordView::GetData() const { return _pData; }
+
+Size RecordView::GetSize() const { return _iTypeVec.size(); }
+
+FieldType RecordView::GetType(FieldID nPos) const { return _iTypeVec[nPos]; }
+
+int RecordView::GetInt(FieldID nPos) const {
+  assert(_iTypeVec[nPos] == FieldType::INT_TYPE);
+  int nData;
+  memcpy(&nData, _pData + _iOffsetVec[nPos], sizeof(int));
+  return nData;
+}
+
+double RecordView::GetFloat(FieldID nPos) const {
+  assert(_iTypeVec[nPos] == FieldType::FLOAT_TYPE);
+  double fData;
+  memcpy(&fData, _pData + _iOffsetVec[nPos], sizeof(double));
+  return fData;
+}
+
+StringView RecordView::GetStringView(FieldID nPos) const {
+  assert(_iTypeVec[nPos] == FieldType::STRING_TYPE);
+  assert(!_iExternalVec[nPos]);
+  const char *pData = (const char *)(_pData + _iOffsetVec[nPos]);
+  // 与StringField::SetData保持一致，字符串在第一个'\0'处截断
+  return StringView(pData, strnlen(pData, _iLenVec[nPos]));
+}
+
+bool RecordView::IsExternal(FieldID nPos) const { return _iExternalVec[nPos]; }
+
+ToastPointer RecordView::GetExternal(FieldID nPos) const {
+  assert(_iExternalVec[nPos]);
+  ToastPointer iPointer;
+  memcpy(&iPointer, _pData + _iOffsetVec[nPos], sizeof(ToastPointer));
+  return iPointer;
+}
+
+Record *RecordView::ToRecord() const {
+  VariableRecord *pRecord =
+      new VariableRecord(_iTypeVec.size(), _iTypeVec, _iSizeVec);
+  pRecord->VarLoad(_pData);
+  return pRecord;
+}
+
+Record *RecordView::ToRecord(const std::vector<FieldID> &iDetoast) const {
+  VariableRecord *pRecord =
+      new VariableRecord(_iTypeVec.size(), _iTypeVec, _iSizeVec);
+  std::vector<ToastPointer> iExternal;
+  pRecord->VarLoad(_pData, iDetoast, iExternal);
+  return pRecord;
+}
+
+}  // namespace thdb
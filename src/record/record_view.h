@@ -0,0 +1,75 @@
+#ifndef THDB_RECORD_VIEW_H_
+#define THDB_RECORD_VIEW_H_
+
+#include "defines.h"
+#include "field/field.h"
+#include "record/record.h"
+#include "record/toast_pointer.h"
+#include "utils/string_view.h"
+
+namespace thdb {
+
+/**
+ * @brief 变长记录序列化数据上的只读视图。
+ * 视图不复制数据，按列直接从字节中读取字段，不为各字段分配Field对象。
+ * 同一个视图可以通过Reset反复指向不同的记录，避免逐条分配内存。
+ * 数据格式与VariableRecord::VarStore一致。
+ */
+class RecordView {
+ public:
+  RecordView(const std::vector<FieldType> &iTypeVec,
+             const std::vector<Size> &iSizeVec);
+  ~RecordView() = default;
+
+  /**
+   * @brief 指向一条新的序列化记录
+   *
+   * @param pData 记录数据，视图使用期间需保持有效
+   */
+  void Reset(const uint8_t *pData);
+  /**
+   * @brief 获得视图指向的序列化数据
+   */
+  const uint8_t *GetData() const;
+  /**
+   * @brief 获得记录中字段数量
+   */
+  Size GetSize() const;
+  FieldType GetType(FieldID nPos) const;
+
+  int GetInt(FieldID nPos) const;
+  double GetFloat(FieldID nPos) const;
+  /**
+   * @brief 获得记录中字符串字段的视图，字段不能溢出存放
+   */
+  StringView GetStringView(FieldID nPos) const;
+  /**
+   * @brief 判断字符串字段是否移出到溢出页面链
+   */
+  bool IsExternal(FieldID nPos) const;
+  ToastPointer GetExternal(FieldID nPos) const;
+  /**
+   * @brief 将视图解码为完整的记录，由调用者负责析构
+   */
+  Record *ToRecord() const;
+  /**
+   * @brief 将视图解码为记录，只读回iDetoast中溢出存放的字段，
+   * 含义与VariableRecord::VarLoad相同
+   */
+  Record *ToRecord(const std::vector<FieldID> &iDetoast) const;
+
+ private:
+  std::vector<FieldType> _iTypeVec;
+  std::vector<Size> _iSizeVec;
+  const uint8_t *_pData;
+  /**
+   * @brief 各字段在记录数据中的偏移与长度
+   */
+  std::vector<PageOffset> _iOffsetVec;
+  std::vector<PageOffset> _iLenVec;
+  std::vector<bool> _iExternalVec;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_RECORD_VIEW_H_
@@ -0,0 +1,29 @@
+#ifndef THDB_TOAST_POINTER_H_
+#define THDB_TOAST_POINTER_H_
+
+#include "defines.h"
+
+namespace thdb {
+
+/**
+ * @brief 变长记录中字符串长度的最高位，置位时字段内容为溢出指针
+ */
+const PageOffset EXTERNAL_FLAG = 0x8000;
+
+/**
+ * @brief 移出到溢出页面链的字符串在记录中留下的指针
+ */
+struct ToastPointer {
+  /**
+   * @brief 溢出页面链的首页编号，为NULL_PAGE时字段内容仍在记录中
+   */
+  PageID nPageID;
+  /**
+   * @brief 字符串的完整长度
+   */
+  Size nSize;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_TOAST_POINTER_H_
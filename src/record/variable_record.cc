@@ -6,6 +6,8 @@
 
 #include "exception/exceptions.h"
 #include "field/fields.h"
+#include "macros.h"
+#include "page/overflow_page.h"
 
 namespace thdb {
 
@@ -64,19 +66,47 @@ Record *VariableRecord::Copy() const {
   return pRecord;
 }
 
-Size VariableRecord::GetTotSize() const {
+/**
+ * @brief 判断字段是否以溢出指针的形式写入
+ */
+static bool IsExternal(const std::vector<ToastPointer> &iExternal,
+                       FieldID nPos) {
+  return nPos < iExternal.size() && iExternal[nPos].nPageID != NULL_PAGE;
+}
+
+Size VariableRecord::GetTotSize(
+    const std::vector<ToastPointer> &iExternal) const {
+  // 与VarStore保持一致，字符串字段按当前内容计算长度，
+  // 否则SetField修改后的记录会按旧长度分配空间
   Size nTotal = sizeof(PageOffset);
   for (uint32_t i = 0; i < _iFields.size(); ++i) {
     if (_iFields[i]->GetType() == FieldType::STRING_TYPE) {
       nTotal += sizeof(PageOffset);
+      if (IsExternal(iExternal, i))
+        nTotal += sizeof(ToastPointer);
+      else
+        nTotal += ((StringField *)_iFields[i])->GetString().size();
+    } else {
+      nTotal += _iSizeVec[i];
     }
   }
-  for (Size nSize : _iSizeVec) nTotal += nSize;
   return nTotal;
 }
 Size VariableRecord::Load(const uint8_t *src) { return 0; }
 
 Size VariableRecord::VarLoad(const uint8_t *src) {
+  std::vector<FieldID> iDetoast(_iFields.size());
+  for (FieldID i = 0; i < iDetoast.size(); ++i) iDetoast[i] = i;
+  std::vector<ToastPointer> iExternal;
+  return VarLoad(src, iDetoast, iExternal);
+}
+
+Size VariableRecord::VarLoad(const uint8_t *src,
+                             const std::vector<FieldID> &iDetoast,
+                             std::vector<ToastPointer> &iExternal) {
+  std::vector<bool> iNeed(_iFields.size(), false);
+  for (const auto &nPos : iDetoast) iNeed[nPos] = true;
+  iExternal.assign(_iFields.size(), ToastPointer{NULL_PAGE, 0});
   uint32_t size = sizeof(PageOffset);
   PageOffset str_num = *(PageOffset *)src;
   std::vector<PageOffset> strLen(str_num);
@@ -93,9 +123,26 @@ Size VariableRecord::VarLoad(const uint8_t *src) {
     } else if (iType == FieldType::FLOAT_TYPE) {
       SetField(i, new FloatField());
     } else if (iType == FieldType::STRING_TYPE) {
-      SetField(i, new StringField(""));
-      _iSizeVec[i] = strLen[cur_str];
+      PageOffset nLen = strLen[cur_str];
       cur_str += 1;
+      if (nLen & EXTERNAL_FLAG) {
+        ToastPointer iPointer;
+        memcpy(&iPointer, src + size, sizeof(ToastPointer));
+        size += nLen & ~EXTERNAL_FLAG;
+        SetField(i, new StringField(""));
+        if (!iNeed[i]) {
+          iExternal[i] = iPointer;
+          continue;
+        }
+        std::vector<uint8_t> iValue(iPointer.nSize);
+        OverflowPage::ReadChain(iPointer.nPageID, iValue.data(),
+                                iPointer.nSize);
+        _iSizeVec[i] = iPointer.nSize;
+        _iFields[i]->SetData(iValue.data(), iPointer.nSize);
+        continue;
+      }
+      SetField(i, new StringField(""));
+      _iSizeVec[i] = nLen;
     } else {
       throw RecordTypeException();
     }
@@ -106,13 +153,17 @@ Size VariableRecord::VarLoad(const uint8_t *src) {
 }
 Size VariableRecord::Store(uint8_t *dst) { return 0; }
 
-Size VariableRecord::VarStore(uint8_t *dst) {
+Size VariableRecord::VarStore(uint8_t *dst,
+                              const std::vector<ToastPointer> &iExternal) {
   int size = 0;
   std::vector<PageOffset> strLen;
   for (uint32_t i = 0; i < _iFields.size(); ++i) {
     if (_iFields[i]->GetType() == FieldType::STRING_TYPE) {
       _iSizeVec[i] = ((StringField *)_iFields[i])->GetString().size();
-      strLen.push_back(_iSizeVec[i]);
+      if (IsExternal(iExternal, i))
+        strLen.push_back(EXTERNAL_FLAG | sizeof(ToastPointer));
+      else
+        strLen.push_back(_iSizeVec[i]);
     }
   }
   PageOffset str_num = strLen.size();
@@ -121,6 +172,11 @@ Size VariableRecord::VarStore(uint8_t *dst) {
   memcpy(dst + size, strLen.data(), sizeof(PageOffset) * strLen.size());
   size += sizeof(PageOffset) * strLen.size();
   for (uint32_t i = 0; i < _iFields.size(); ++i) {
+    if (IsExternal(iExternal, i)) {
+      memcpy(dst + size, &iExternal[i], sizeof(ToastPointer));
+      size += sizeof(ToastPointer);
+      continue;
+    }
     _iFields[i]->GetData(dst + size, _iSizeVec[i]);
     size += _iSizeVec[i];
   }
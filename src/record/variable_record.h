@@ -4,6 +4,7 @@
 #include "defines.h"
 #include "field/field.h"
 #include "record/record.h"
+#include "record/toast_pointer.h"
 
 namespace thdb {
 
@@ -20,7 +21,19 @@ class VariableRecord : public Record {
    * @return Size 反序列化使用的数据长度
    */
   Size Load(const uint8_t *src) override;
+  /**
+   * @brief 变长格式反序列化，溢出存放的字符串从溢出页面链中读回
+   */
   Size VarLoad(const uint8_t *src);
+  /**
+   * @brief 变长格式反序列化，只从溢出页面链读回iDetoast中的字段。
+   * 其余溢出存放的字段内容为空，调用者不应读取这些字段。
+   *
+   * @param iDetoast 需要读回内容的字段
+   * @param iExternal 各字段未读回的溢出指针，其余字段的nPageID为NULL_PAGE
+   */
+  Size VarLoad(const uint8_t *src, const std::vector<FieldID> &iDetoast,
+               std::vector<ToastPointer> &iExternal);
   /**
    * @brief 记录序列化
    *
@@ -28,14 +41,25 @@ class VariableRecord : public Record {
    * @return Size 序列化使用的数据长度
    */
   Size Store(uint8_t *dst) override;
-  Size VarStore(uint8_t *dst);
+  /**
+   * @brief 变长格式序列化
+   *
+   * @param iExternal 各字段的溢出指针，为空或指针nPageID为NULL_PAGE的
+   * 字段写入内容，其余字符串字段只写入指针
+   */
+  Size VarStore(uint8_t *dst, const std::vector<ToastPointer> &iExternal =
+                                  std::vector<ToastPointer>());
   /**
    * @brief 从String数据构建记录
    *
    * @param iRawVec Insert语句中的String数组
    */
   void Build(const std::vector<String> &iRawVec) override;
-  Size GetTotSize() const;
+  /**
+   * @brief 获得变长格式序列化后的长度，iExternal含义与VarStore相同
+   */
+  Size GetTotSize(const std::vector<ToastPointer> &iExternal =
+                      std::vector<ToastPointer>()) const;
 
   Record *Copy() const;
   /**
@@ -5,6 +5,96 @@
 
 #include "defines.h"
 
-namespace thdb {}  // namespace thdb
+namespace thdb {
+
+/**
+ * @brief 页面存储方式：经由缓冲池读写页面文件，或直接内存映射页面文件
+ */
+enum class StorageMode { BUFFER_POOL = 0, MMAP = 1 };
+
+const StorageMode STORAGE_MODE = StorageMode::BUFFER_POOL;
+
+/**
+ * @brief 新建数据库时默认的页面大小，须为MIN_PAGE_SIZE到MAX_PAGE_SIZE之间的2的幂
+ */
+const Size DEFAULT_PAGE_SIZE = 4096;
+
+/**
+ * @brief 脏页数量达到该值时将全部脏页提交后台写回
+ */
+const Size FLUSH_DIRTY_PAGES = 4096;
+
+/**
+ * @brief 缓冲池页框区是否尝试使用大页(MAP_HUGETLB或透明大页)
+ */
+const bool BUFFER_POOL_HUGE_PAGES = false;
+
+/**
+ * @brief 后台写回线程数量
+ */
+const Size PAGE_WRITER_THREADS = 2;
+
+/**
+ * @brief 后台每秒最多写回的页面数量，为0时不限速
+ */
+const Size PAGE_WRITER_RATE_LIMIT = 0;
+
+/**
+ * @brief 后台写回队列最多积压的页面数量，超过时前台等待
+ */
+const Size PAGE_WRITER_QUEUE_LIMIT = 8192;
+
+/**
+ * @brief 队列中只剩正在写回的页面时，写回线程每次等待的最长毫秒数
+ */
+const Size PAGE_WRITER_RETRY_MS = 10;
+
+/**
+ * @brief 表和索引每次预留的连续页面数量，须为不超过64的2的幂
+ */
+const Size EXTENT_PAGES = 16;
+
+/**
+ * @brief 顺序扫描时预读的页面数量，为0时不预读
+ */
+const Size READ_AHEAD_PAGES = 32;
+
+/**
+ * @brief 每类页面解码结果缓存最多保存的页面数量
+ */
+const Size DECODED_CACHE_PAGES = 1024;
+
+/**
+ * @brief 字符串字段超过该长度时移出到溢出页面存放，数据页面只保留指针
+ */
+const Size TOAST_THRESHOLD = 1024;
+
+/**
+ * @brief 每个数据页面上每个布隆过滤器列占用的字节数
+ */
+const Size BLOOM_FILTER_BYTES = 256;
+
+/**
+ * @brief 布隆过滤器每个键设置的位数
+ */
+const Size BLOOM_FILTER_HASHES = 3;
+
+/**
+ * @brief 整数范围最多包含该数量的取值时逐个查询布隆过滤器，更宽的范围不查询
+ */
+const Size BLOOM_PROBE_VALUES = 16;
+
+/**
+ * @brief 存活数据不超过页面容量的该百分比时，整理表时将页面中的记录搬出
+ */
+const Size VACUUM_SPARSE_PERCENT = 25;
+
+/**
+ * @brief 一个表删除的记录数量达到该值时，由Instance::RunDeferred
+ * 在语句之间自动整理该表，为0时不自动整理
+ */
+const Size AUTOVACUUM_DELETES = 4096;
+
+}  // namespace thdb
 
 #endif
\ No newline at end of file
@@ -11,6 +11,8 @@
 #include "manager/table_manager.h"
 #include "record/fixed_record.h"
 #include "record/variable_record.h"
+#include "settings.h"
+#include "table/table_scan_cursor.h"
 
 namespace thdb {
 
@@ -43,7 +45,7 @@ bool Instance::CreateTable(const String &sTableName, const Schema &iSchema,
     String name = "TxnID";
     Column col(name, FieldType::INT_TYPE);
     temp.push_back(col);
-    Schema new_schema(temp);
+    Schema new_schema(temp, iSchema.GetLayout());
     _pTableManager->AddTable(sTableName, new_schema);
   } else {
     _pTableManager->AddTable(sTableName, iSchema);
@@ -55,6 +57,7 @@ bool Instance::DropTable(const String &sTableName) {
   for (const auto &sColName : _pIndexManager->GetTableIndexes(sTableName))
     _pIndexManager->DropIndex(sTableName, sColName);
   _pTableManager->DropTable(sTableName);
+  _iVacuumSet.erase(sTableName);
   return true;
 }
 
@@ -94,147 +97,268 @@ std::vector<PageSlotID> Intersection(std::vector<PageSlotID> iA,
   return iRes;
 }
 
+/**
+ * @brief 判断记录对事务是否可见，记录的最后一个字段为写入它的事务编号
+ */
+bool IsVisible(Record *pRecord, Transaction *txn) {
+  if (txn == nullptr) return true;
+  TxnID txn_id;
+  pRecord->GetField(pRecord->GetSize() - 1)
+      ->GetData((uint8_t *)&txn_id, sizeof(txn_id));
+  return !(txn->is_Active(txn_id) || txn->GetID() < txn_id);
+}
+
+bool IsVisible(const RecordView &iView, Transaction *txn) {
+  if (txn == nullptr) return true;
+  TxnID txn_id = iView.GetInt(iView.GetSize() - 1);
+  return !(txn->is_Active(txn_id) || txn->GetID() < txn_id);
+}
+
+std::vector<PageSlotID> Instance::IndexSearch(
+    const std::vector<Condition *> &iIndexCond) const {
+  IndexCondition *pIndexCond = dynamic_cast<IndexCondition *>(iIndexCond[0]);
+  assert(pIndexCond != nullptr);
+  auto iName = pIndexCond->GetIndexName();
+  auto iRange = pIndexCond->GetIndexRange();
+  std::vector<PageSlotID> iRes =
+      GetIndex(iName.first, iName.second)->Range(iRange.first, iRange.second);
+  for (Size i = 1; i < iIndexCond.size(); ++i) {
+    IndexCondition *pIndexCond = dynamic_cast<IndexCondition *>(iIndexCond[i]);
+    auto iName = pIndexCond->GetIndexName();
+    auto iRange = pIndexCond->GetIndexRange();
+    iRes = Intersection(iRes, GetIndex(iName.first, iName.second)
+                                  ->Range(iRange.first, iRange.second));
+  }
+  return iRes;
+}
+
 std::vector<PageSlotID> Instance::Search(
     const String &sTableName, Condition *pCond,
     const std::vector<Condition *> &iIndexCond, Transaction *txn) {
   Table *pTable = GetTable(sTableName);
   if (pTable == nullptr) throw TableException();
   if (iIndexCond.size() > 0) {
-    IndexCondition *pIndexCond = dynamic_cast<IndexCondition *>(iIndexCond[0]);
-    assert(pIndexCond != nullptr);
-    auto iName = pIndexCond->GetIndexName();
-    auto iRange = pIndexCond->GetIndexRange();
-    std::vector<PageSlotID> iRes =
-        GetIndex(iName.first, iName.second)->Range(iRange.first, iRange.second);
-    for (Size i = 1; i < iIndexCond.size(); ++i) {
-      IndexCondition *pIndexCond =
-          dynamic_cast<IndexCondition *>(iIndexCond[i]);
-      auto iName = pIndexCond->GetIndexName();
-      auto iRange = pIndexCond->GetIndexRange();
-      iRes = Intersection(iRes, GetIndex(iName.first, iName.second)
-                                    ->Range(iRange.first, iRange.second));
-    }
+    std::vector<PageSlotID> iRes = IndexSearch(iIndexCond);
     if (txn != nullptr) {
       for (auto it = iRes.begin(); it != iRes.end();) {
-        Record *temp = pTable->GetRecord(it->first, it->second);
-        TxnID txn_id;
-        temp->GetField(temp->GetSize() - 1)
-            ->GetData((uint8_t *)&txn_id, sizeof(txn_id));
-        if (txn->is_Active(txn_id) || txn->GetID() < txn_id) {
+        // 可见性只取决于最后的事务编号列，不读回溢出存放的字符串
+        Record *temp = pTable->GetRecord(it->first, it->second, {});
+        if (!IsVisible(temp, txn)) {
           it = iRes.erase(it);
         } else {
           ++it;
         }
+        delete temp;
       }
     }
     return iRes;
   } else {
-    std::vector<PageSlotID> iRes = pTable->SearchRecord(pCond);
-    if (txn != nullptr) {
-      for (auto it = iRes.begin(); it != iRes.end();) {
-        Record *temp = pTable->GetRecord(it->first, it->second);
-        TxnID txn_id;
-        temp->GetField(temp->GetSize() - 1)
-            ->GetData((uint8_t *)&txn_id, sizeof(txn_id));
-        if (txn->is_Active(txn_id) || txn->GetID() < txn_id) {
-          it = iRes.erase(it);
-        } else {
-          ++it;
-        }
-      }
-    }
+    // 可见性判断直接使用游标解码出的记录，无需再次读取
+    std::vector<PageSlotID> iRes;
+    TableScanCursor iCursor(pTable, pCond);
+    while (iCursor.Next())
+      if (IsVisible(iCursor.GetView(), txn))
+        iRes.push_back(iCursor.GetPageSlotID());
+    return iRes;
+  }
+}
+
+std::vector<Record *> Instance::Select(
+    const String &sTableName, Condition *pCond,
+    const std::vector<Condition *> &iIndexCond, Transaction *txn) {
+  Table *pTable = GetTable(sTableName);
+  if (pTable == nullptr) throw TableException();
+  std::vector<Record *> iRes;
+  if (iIndexCond.size() > 0) {
+    for (const auto &iPair : Search(sTableName, pCond, iIndexCond, txn))
+      iRes.push_back(GetRecord(sTableName, iPair, txn));
     return iRes;
   }
+  TableScanCursor iCursor(pTable, pCond);
+  while (iCursor.Next()) {
+    if (!IsVisible(iCursor.GetView(), txn)) continue;
+    Record *pRecord = iCursor.TakeRecord();
+    if (txn != nullptr) pRecord->Remove(pRecord->GetSize() - 1);
+    iRes.push_back(pRecord);
+  }
+  return iRes;
 }
 
 PageSlotID Instance::Insert(const String &sTableName,
                             const std::vector<String> &iRawVec,
                             Transaction *txn) {
+  return InsertMany(sTableName, {iRawVec}, txn)[0];
+}
+
+std::vector<PageSlotID> Instance::InsertMany(
+    const String &sTableName, const std::vector<std::vector<String>> &iRawVecs,
+    Transaction *txn) {
   Table *pTable = GetTable(sTableName);
   if (pTable == nullptr) throw TableException();
-  Record *pRecord = pTable->EmptyRecord();
-  if (txn == nullptr) {
-    pRecord->Build(iRawVec);
-  } else {
-    std::vector<String> temp = iRawVec;
-    temp.push_back(std::to_string(txn->GetID()));
-    pRecord->Build(temp);
+  std::vector<Record *> iRecordVec;
+  std::vector<PageSlotID> iPairs;
+  // 字段格式错误时Build会抛出异常，已构建的记录需要在重新抛出前析构
+  try {
+    for (const auto &iRawVec : iRawVecs) {
+      Record *pRecord = pTable->EmptyRecord();
+      iRecordVec.push_back(pRecord);
+      if (txn == nullptr) {
+        pRecord->Build(iRawVec);
+      } else {
+        std::vector<String> temp = iRawVec;
+        temp.push_back(std::to_string(txn->GetID()));
+        pRecord->Build(temp);
+      }
+    }
+    iPairs = pTable->InsertBatch(iRecordVec);
+    // Handle Insert on Index
+    if (_pIndexManager->HasIndex(sTableName)) {
+      auto iColNames = _pIndexManager->GetTableIndexes(sTableName);
+      for (const auto &sCol : iColNames) {
+        FieldID nPos = pTable->GetPos(sCol);
+        std::vector<std::pair<Field *, PageSlotID>> iEntries;
+        for (Size i = 0; i < iRecordVec.size(); ++i)
+          iEntries.push_back({iRecordVec[i]->GetField(nPos), iPairs[i]});
+        _pIndexManager->GetIndex(sTableName, sCol)->InsertBatch(iEntries);
+      }
+    }
+    if (txn) {
+      for (const auto &iPair : iPairs)
+        txn->InsertRecord(_pRecoveryManager, sTableName, iPair);
+    }
+  } catch (...) {
+    for (const auto &pRecord : iRecordVec) delete pRecord;
+    throw;
+  }
+
+  for (const auto &pRecord : iRecordVec) delete pRecord;
+  return iPairs;
+}
+
+void Instance::DeleteOne(const String &sTableName, Table *pTable,
+                         const PageSlotID &iPair, Record *pRecord) {
+  // Handle Delete on Index
+  for (const auto &sCol : _pIndexManager->GetTableIndexes(sTableName)) {
+    Field *pKey = pRecord->GetField(pTable->GetPos(sCol));
+    _pIndexManager->GetIndex(sTableName, sCol)->Delete(pKey, iPair);
   }
-  PageSlotID iPair = pTable->InsertRecord(pRecord);
+  pTable->DeleteRecord(iPair.first, iPair.second);
+}
+
+std::vector<String> Instance::UpdatedIndexes(
+    const String &sTableName, Table *pTable,
+    const std::vector<Transform> &iTrans) {
+  std::vector<String> iColNames;
+  for (const auto &sCol : _pIndexManager->GetTableIndexes(sTableName)) {
+    FieldID nPos = pTable->GetPos(sCol);
+    for (const auto &iTran : iTrans)
+      if (iTran.GetPos() == nPos) {
+        iColNames.push_back(sCol);
+        break;
+      }
+  }
+  return iColNames;
+}
+
+std::vector<FieldID> Instance::GetPositions(
+    Table *pTable, const std::vector<String> &iColNames) const {
+  std::vector<FieldID> iPosVec;
+  for (const auto &sCol : iColNames) iPosVec.push_back(pTable->GetPos(sCol));
+  return iPosVec;
+}
+
+void Instance::UpdateOne(const String &sTableName, Table *pTable,
+                         const PageSlotID &iPair, Record *pRecord,
+                         const std::vector<Transform> &iTrans) {
+  // 记录位置在更新后保持不变，只有键值改变的索引需要改写
+  auto iColNames = UpdatedIndexes(sTableName, pTable, iTrans);
+  // Handle Delete on Index
+  for (const auto &sCol : iColNames) {
+    Field *pKey = pRecord->GetField(pTable->GetPos(sCol));
+    _pIndexManager->GetIndex(sTableName, sCol)->Delete(pKey, iPair);
+  }
+
+  pTable->UpdateRecord(iPair.first, iPair.second, iTrans);
+
   // Handle Insert on Index
-  if (_pIndexManager->HasIndex(sTableName)) {
-    auto iColNames = _pIndexManager->GetTableIndexes(sTableName);
+  if (!iColNames.empty()) {
+    for (const auto &iTran : iTrans)
+      pRecord->SetField(iTran.GetPos(), iTran.GetField());
     for (const auto &sCol : iColNames) {
-      FieldID nPos = pTable->GetPos(sCol);
-      Field *pKey = pRecord->GetField(nPos);
+      Field *pKey = pRecord->GetField(pTable->GetPos(sCol));
       _pIndexManager->GetIndex(sTableName, sCol)->Insert(pKey, iPair);
     }
   }
-  if (txn) txn->InsertRecord(_pRecoveryManager, sTableName, iPair);
-
-  delete pRecord;
-  return iPair;
 }
 
 uint32_t Instance::Delete(const String &sTableName, Condition *pCond,
                           const std::vector<Condition *> &iIndexCond,
                           Transaction *txn) {
-  auto iResVec = Search(sTableName, pCond, iIndexCond);
   Table *pTable = GetTable(sTableName);
-  bool bHasIndex = _pIndexManager->HasIndex(sTableName);
-  for (const auto &iPair : iResVec) {
-    // Handle Delete on Index
-    if (bHasIndex) {
-      Record *pRecord = pTable->GetRecord(iPair.first, iPair.second);
-      auto iColNames = _pIndexManager->GetTableIndexes(sTableName);
-      for (const auto &sCol : iColNames) {
-        FieldID nPos = pTable->GetPos(sCol);
-        Field *pKey = pRecord->GetField(nPos);
-        _pIndexManager->GetIndex(sTableName, sCol)->Delete(pKey, iPair);
-      }
+  if (pTable == nullptr) throw TableException();
+  uint32_t nCount = 0;
+  std::vector<FieldID> iKeyVec =
+      GetPositions(pTable, _pIndexManager->GetTableIndexes(sTableName));
+  if (iIndexCond.size() > 0) {
+    for (const auto &iPair : Search(sTableName, pCond, iIndexCond)) {
+      Record *pRecord = pTable->GetRecord(iPair.first, iPair.second, iKeyVec);
+      DeleteOne(sTableName, pTable, iPair, pRecord);
       delete pRecord;
+      ++nCount;
     }
-
-    pTable->DeleteRecord(iPair.first, iPair.second);
+    if (AUTOVACUUM_DELETES > 0 &&
+        pTable->GetDeletedCount() >= AUTOVACUUM_DELETES)
+      _iVacuumSet.insert(sTableName);
+    return nCount;
   }
-  return iResVec.size();
+  // 游标在返回记录前已关闭当前页面，可以直接删除刚读到的记录
+  // 只有需要维护索引时才解码记录，且只读回索引列的溢出内容
+  bool bHasIndex = _pIndexManager->HasIndex(sTableName);
+  {
+    TableScanCursor iCursor(pTable, pCond);
+    while (iCursor.Next()) {
+      Record *pRecord = bHasIndex ? iCursor.GetView().ToRecord(iKeyVec)
+                                  : nullptr;
+      DeleteOne(sTableName, pTable, iCursor.GetPageSlotID(), pRecord);
+      if (pRecord) delete pRecord;
+      ++nCount;
+    }
+  }
+  // 删除累积到一定数量后登记该表，由RunDeferred在语句之间整理
+  if (AUTOVACUUM_DELETES > 0 && pTable->GetDeletedCount() >= AUTOVACUUM_DELETES)
+    _iVacuumSet.insert(sTableName);
+  return nCount;
 }
 
 uint32_t Instance::Update(const String &sTableName, Condition *pCond,
                           const std::vector<Condition *> &iIndexCond,
                           const std::vector<Transform> &iTrans,
                           Transaction *txn) {
-  auto iResVec = Search(sTableName, pCond, iIndexCond);
   Table *pTable = GetTable(sTableName);
-  bool bHasIndex = _pIndexManager->HasIndex(sTableName);
-  for (const auto &iPair : iResVec) {
-    // Handle Delete on Index
-    if (bHasIndex) {
-      Record *pRecord = pTable->GetRecord(iPair.first, iPair.second);
-      auto iColNames = _pIndexManager->GetTableIndexes(sTableName);
-      for (const auto &sCol : iColNames) {
-        FieldID nPos = pTable->GetPos(sCol);
-        Field *pKey = pRecord->GetField(nPos);
-        _pIndexManager->GetIndex(sTableName, sCol)->Delete(pKey, iPair);
-      }
-      delete pRecord;
-    }
-
-    pTable->UpdateRecord(iPair.first, iPair.second, iTrans);
-
-    // Handle Delete on Index
-    if (bHasIndex) {
-      Record *pRecord = pTable->GetRecord(iPair.first, iPair.second);
-      auto iColNames = _pIndexManager->GetTableIndexes(sTableName);
-      for (const auto &sCol : iColNames) {
-        FieldID nPos = pTable->GetPos(sCol);
-        Field *pKey = pRecord->GetField(nPos);
-        _pIndexManager->GetIndex(sTableName, sCol)->Insert(pKey, iPair);
-      }
+  if (pTable == nullptr) throw TableException();
+  uint32_t nCount = 0;
+  std::vector<FieldID> iKeyVec =
+      GetPositions(pTable, UpdatedIndexes(sTableName, pTable, iTrans));
+  if (iIndexCond.size() > 0) {
+    for (const auto &iPair : Search(sTableName, pCond, iIndexCond)) {
+      Record *pRecord = pTable->GetRecord(iPair.first, iPair.second, iKeyVec);
+      UpdateOne(sTableName, pTable, iPair, pRecord, iTrans);
       delete pRecord;
+      ++nCount;
     }
+    return nCount;
   }
-  return iResVec.size();
+  // 迁出的记录只经由原始槽扫描到，变长更新不会导致同一行被重复更新
+  bool bHasIndex = !iKeyVec.empty();
+  TableScanCursor iCursor(pTable, pCond);
+  while (iCursor.Next()) {
+    Record *pRecord = bHasIndex ? iCursor.GetView().ToRecord(iKeyVec)
+                                : nullptr;
+    UpdateOne(sTableName, pTable, iCursor.GetPageSlotID(), pRecord, iTrans);
+    if (pRecord) delete pRecord;
+    ++nCount;
+  }
+  return nCount;
 }
 
 Record *Instance::GetRecord(const String &sTableName, const PageSlotID &iPair,
@@ -300,34 +424,75 @@ std::vector<Record *> Instance::GetIndexInfos() const {
 
 bool Instance::CreateIndex(const String &sTableName, const String &sColName,
                            FieldType iType) {
-  auto iAll = Search(sTableName, nullptr, {});
   _pIndexManager->AddIndex(sTableName, sColName, iType);
   Table *pTable = GetTable(sTableName);
+  FieldID nPos = pTable->GetPos(sColName);
+  Index *pIndex = _pIndexManager->GetIndex(sTableName, sColName);
   // Handle Exists Data
-  for (const auto &iPair : iAll) {
-    FieldID nPos = pTable->GetPos(sColName);
-    Record *pRecord = pTable->GetRecord(iPair.first, iPair.second);
-    Field *pKey = pRecord->GetField(nPos);
-    _pIndexManager->GetIndex(sTableName, sColName)->Insert(pKey, iPair);
-    delete pRecord;
-  }
+  TableScanCursor iCursor(pTable, nullptr);
+  while (iCursor.Next())
+    pIndex->Insert(iCursor.GetRecord()->GetField(nPos),
+                   iCursor.GetPageSlotID());
   return true;
 }
 
 bool Instance::DropIndex(const String &sTableName, const String &sColName) {
-  auto iAll = Search(sTableName, nullptr, {});
   Table *pTable = GetTable(sTableName);
-  for (const auto &iPair : iAll) {
-    FieldID nPos = pTable->GetPos(sColName);
-    Record *pRecord = pTable->GetRecord(iPair.first, iPair.second);
-    Field *pKey = pRecord->GetField(nPos);
-    _pIndexManager->GetIndex(sTableName, sColName)->Delete(pKey, iPair);
-    delete pRecord;
-  }
+  FieldID nPos = pTable->GetPos(sColName);
+  Index *pIndex = _pIndexManager->GetIndex(sTableName, sColName);
+  TableScanCursor iCursor(pTable, nullptr);
+  while (iCursor.Next())
+    pIndex->Delete(iCursor.GetRecord()->GetField(nPos),
+                   iCursor.GetPageSlotID());
   _pIndexManager->DropIndex(sTableName, sColName);
   return true;
 }
 
+bool Instance::CreateBloomFilter(const String &sTableName,
+                                 const String &sColName) {
+  Table *pTable = GetTable(sTableName);
+  if (pTable == nullptr) throw TableException();
+  return pTable->AddBloomFilter(pTable->GetPos(sColName));
+}
+
+bool Instance::DropBloomFilter(const String &sTableName,
+                               const String &sColName) {
+  Table *pTable = GetTable(sTableName);
+  if (pTable == nullptr) throw TableException();
+  return pTable->DropBloomFilter(pTable->GetPos(sColName));
+}
+
+uint32_t Instance::Vacuum(const String &sTableName) {
+  Table *pTable = GetTable(sTableName);
+  if (pTable == nullptr) throw TableException();
+  std::vector<std::pair<PageSlotID, PageSlotID>> iMoves;
+  uint32_t nFreed =
+      pTable->Vacuum(!_pTransactionManager->HasActive(), iMoves);
+  std::vector<String> iColNames = _pIndexManager->GetTableIndexes(sTableName);
+  if (iColNames.empty()) return nFreed;
+  std::vector<FieldID> iKeyVec = GetPositions(pTable, iColNames);
+  for (const auto &iMove : iMoves) {
+    Record *pRecord =
+        pTable->GetRecord(iMove.second.first, iMove.second.second, iKeyVec);
+    for (const auto &sCol : iColNames) {
+      Field *pKey = pRecord->GetField(pTable->GetPos(sCol));
+      Index *pIndex = _pIndexManager->GetIndex(sTableName, sCol);
+      pIndex->Delete(pKey, iMove.first);
+      pIndex->Insert(pKey, iMove.second);
+    }
+    delete pRecord;
+  }
+  return nFreed;
+}
+
+uint32_t Instance::RunDeferred() {
+  std::set<String> iTables;
+  iTables.swap(_iVacuumSet);
+  uint32_t nFreed = 0;
+  for (const auto &sTableName : iTables) nFreed += Vacuum(sTableName);
+  return nFreed;
+}
+
 void Advance(std::vector<std::pair<Field *, Record *>> &all, Size &subset,
              Size &cur, FieldType ftype) {
   subset = cur;
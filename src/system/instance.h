@@ -1,6 +1,8 @@
 #ifndef THDB_INSTANCE_H_
 #define THDB_INSTANCE_H_
 
+#include <set>
+
 #include "condition/conditions.h"
 #include "defines.h"
 #include "field/fields.h"
@@ -39,6 +41,15 @@ class Instance {
   std::vector<PageSlotID> Search(const String &sTableName, Condition *pCond,
                                  const std::vector<Condition *> &iIndexCond,
                                  Transaction *txn = nullptr);
+  /**
+   * @brief 检索并返回符合条件的记录本身。
+   * 无索引条件时直接使用扫描游标解码出的记录，每条记录只解码一次。
+   *
+   * @return std::vector<Record *> 符合条件的记录，由调用者负责析构
+   */
+  std::vector<Record *> Select(const String &sTableName, Condition *pCond,
+                               const std::vector<Condition *> &iIndexCond,
+                               Transaction *txn = nullptr);
   uint32_t Delete(const String &sTableName, Condition *pCond,
                   const std::vector<Condition *> &iIndexCond,
                   Transaction *txn = nullptr);
@@ -49,6 +60,18 @@ class Instance {
   PageSlotID Insert(const String &sTableName,
                     const std::vector<String> &iRawVec,
                     Transaction *txn = nullptr);
+  /**
+   * @brief 批量插入多条记录，表页面和索引均按批处理
+   *
+   * @param sTableName 表名
+   * @param iRawVecs 每条记录各字段的原始字符串
+   * @param txn 所属事务
+   * @return std::vector<PageSlotID> 各条记录插入的位置
+   */
+  std::vector<PageSlotID> InsertMany(
+      const String &sTableName,
+      const std::vector<std::vector<String>> &iRawVecs,
+      Transaction *txn = nullptr);
 
   Record *GetRecord(const String &sTableName, const PageSlotID &iPair,
                     Transaction *txn = nullptr) const;
@@ -72,6 +95,29 @@ class Instance {
   bool CreateIndex(const String &sTableName, const String &sColName,
                    FieldType iType);
   bool DropIndex(const String &sTableName, const String &sColName);
+  /**
+   * @brief 为整数列建立按页面的布隆过滤器。
+   * 之后插入和更新的记录自动加入过滤器，等值条件的扫描跳过不含该键的页面。
+   *
+   * @return false 该列不是整数列或已经建立了过滤器
+   */
+  bool CreateBloomFilter(const String &sTableName, const String &sColName);
+  bool DropBloomFilter(const String &sTableName, const String &sColName);
+  /**
+   * @brief 整理表的数据页面，搬空稀疏页面并释放空页面，
+   * 同步更新被搬动记录的索引项。
+   * 存在活跃事务时事务日志引用着记录位置，此时只释放空页面，不搬动记录。
+   *
+   * @return uint32_t 释放的页面数量
+   */
+  uint32_t Vacuum(const String &sTableName);
+  /**
+   * @brief 整理删除语句登记的表。删除数量达到AUTOVACUUM_DELETES时，
+   * 删除语句只登记该表，由调用者在语句之间调用本函数完成整理。
+   *
+   * @return uint32_t 释放的页面数量
+   */
+  uint32_t RunDeferred();
 
   TransactionManager *GetTransactionManager() const {
     return _pTransactionManager;
@@ -93,10 +139,42 @@ class Instance {
       std::vector<Condition *> &iJoinConds);
 
  private:
+  /**
+   * @brief 求多个索引条件检索结果的交集
+   */
+  std::vector<PageSlotID> IndexSearch(
+      const std::vector<Condition *> &iIndexCond) const;
+  /**
+   * @brief 删除一条已解码的记录及其索引项，表上没有索引时pRecord可以为nullptr
+   */
+  void DeleteOne(const String &sTableName, Table *pTable,
+                 const PageSlotID &iPair, Record *pRecord);
+  /**
+   * @brief 更新一条已解码的记录及其索引项，pRecord会被修改为更新后的内容。
+   * 更新不涉及索引列时pRecord可以为nullptr
+   */
+  void UpdateOne(const String &sTableName, Table *pTable,
+                 const PageSlotID &iPair, Record *pRecord,
+                 const std::vector<Transform> &iTrans);
+  /**
+   * @brief 获得更新会修改的索引列
+   */
+  std::vector<String> UpdatedIndexes(const String &sTableName, Table *pTable,
+                                     const std::vector<Transform> &iTrans);
+  /**
+   * @brief 获得各列在表中的位置，维护索引时只需读回这些列的溢出内容
+   */
+  std::vector<FieldID> GetPositions(Table *pTable,
+                                    const std::vector<String> &iColNames) const;
+
   TableManager *_pTableManager;
   IndexManager *_pIndexManager;
   TransactionManager *_pTransactionManager;
   RecoveryManager *_pRecoveryManager;
+  /**
+   * @brief 等待RunDeferred自动整理的表
+   */
+  std::set<String> _iVacuumSet;
 };
 
 }  // namespace thdb
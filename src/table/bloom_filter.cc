@@ -0,0 +1,102 @@
+#include "table/bloom_filter.h"
+
+#include <cstring>
+
+#include "macros.h"
+#include "settings.h"
+
+namespace thdb {
+
+const Size BLOOM_FILTER_BITS = BLOOM_FILTER_BYTES * 8;
+
+/**
+ * @brief 由键生成两个独立的哈希值，第i个位置为h1 + i * h2
+ */
+void BloomHash(int nKey, uint32_t &nHash1, uint32_t &nHash2) {
+  uint64_t nHash = (uint32_t)nKey + 0x9E3779B97F4A7C15ULL;
+  nHash = (nHash ^ (nHash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  nHash = (nHash ^ (nHash >> 27)) * 0x94D049BB133111EBULL;
+  nHash ^= nHash >> 31;
+  nHash1 = (uint32_t)nHash;
+  nHash2 = (uint32_t)(nHash >> 32) | 1;
+}
+
+/**
+ * @brief 以一个数据页面的布隆过滤器作为概要，只能回答整数列上的窄范围
+ */
+class BloomProbe : public RangeProbe {
+ public:
+  BloomProbe(const uint8_t *pEntry, const std::vector<int> &iIndexVec)
+      : _pEntry(pEntry), _iIndexVec(iIndexVec) {}
+
+  bool MayInRange(FieldID nPos, double fLow, double fHigh, bool bInt,
+                  bool &bMust) const override {
+    bMust = false;
+    if (!bInt || _iIndexVec[nPos] < 0) return true;
+    if (fHigh - fLow > BLOOM_PROBE_VALUES) return true;
+    const uint8_t *pBits = _pEntry + BLOOM_FILTER_BYTES * _iIndexVec[nPos];
+    for (double fKey = fLow; fKey < fHigh; fKey += 1)
+      if (BloomFilter::MayContain(pBits, (int)fKey)) return true;
+    return false;
+  }
+
+ private:
+  const uint8_t *_pEntry;
+  const std::vector<int> &_iIndexVec;
+};
+
+BloomFilter::BloomFilter(PageID nOwner, PageID nFirstID,
+                         const std::vector<FieldID> &iColVec,
+                         const std::vector<FieldType> &iTypeVec,
+                         const std::vector<Size> &iSizeVec)
+    : PageSummary(nOwner, nFirstID, BLOOM_FILTER_BYTES * iColVec.size()),
+      _iColVec(iColVec),
+      _iIndexVec(iTypeVec.size(), -1),
+      _iView(iTypeVec, iSizeVec) {
+  for (Size i = 0; i < _iColVec.size(); ++i) _iIndexVec[_iColVec[i]] = i;
+}
+
+void BloomFilter::InitEntry(uint8_t *pEntry) const {
+  memset(pEntry, 0, _nEntrySize);
+}
+
+bool BloomFilter::MayContain(const uint8_t *pBits, int nKey) {
+  uint32_t nHash1, nHash2;
+  BloomHash(nKey, nHash1, nHash2);
+  for (Size i = 0; i < BLOOM_FILTER_HASHES; ++i) {
+    uint32_t nBit = (nHash1 + i * nHash2) % BLOOM_FILTER_BITS;
+    if (!(pBits[nBit >> 3] & (1 << (nBit & 7)))) return false;
+  }
+  return true;
+}
+
+void BloomFilter::Add(PageID nHeapID, const uint8_t *pData) {
+  uint8_t *pEntry = GetMutableEntry(nHeapID);
+  if (pEntry == nullptr) return;
+  bool bChanged = false;
+  _iView.Reset(pData);
+  for (Size i = 0; i < _iColVec.size(); ++i) {
+    uint8_t *pBits = pEntry + BLOOM_FILTER_BYTES * i;
+    uint32_t nHash1, nHash2;
+    BloomHash(_iView.GetInt(_iColVec[i]), nHash1, nHash2);
+    for (Size j = 0; j < BLOOM_FILTER_HASHES; ++j) {
+      uint32_t nBit = (nHash1 + j * nHash2) % BLOOM_FILTER_BITS;
+      uint8_t nMask = 1 << (nBit & 7);
+      bChanged |= !(pBits[nBit >> 3] & nMask);
+      pBits[nBit >> 3] |= nMask;
+    }
+  }
+  if (bChanged) SetDirty(nHeapID);
+}
+
+bool BloomFilter::MayMatch(PageID nHeapID, const RecordFilter &iFilter) const {
+  const uint8_t *pEntry = GetEntry(nHeapID);
+  if (pEntry == nullptr) return true;
+  return iFilter.MayMatch(BloomProbe(pEntry, _iIndexVec));
+}
+
+const std::vector<FieldID> &BloomFilter::GetColumns() const {
+  return _iColVec;
+}
+
+}  // namespace thdb
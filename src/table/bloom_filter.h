@@ -0,0 +1,70 @@
+#ifndef THDB_BLOOM_FILTER_H_
+#define THDB_BLOOM_FILTER_H_
+
+#include <vector>
+
+#include "defines.h"
+#include "field/field.h"
+#include "record/record_filter.h"
+#include "record/record_view.h"
+#include "table/page_summary.h"
+
+namespace thdb {
+
+/**
+ * @brief 表的布隆过滤器。
+ * 为表中每个数据页面的若干整数列各维护一个BLOOM_FILTER_BYTES字节的布隆过滤器。
+ * 插入和更新只设置位，删除不清除，过滤器总是包含页面上记录的所有键。
+ * 等值条件的键不在过滤器中时，扫描可以跳过整个页面。
+ */
+class BloomFilter : public PageSummary {
+ public:
+  /**
+   * @brief 导入以nFirstID开始的布隆过滤器，nFirstID为NULL_PAGE时构建空过滤器
+   *
+   * @param nOwner 所属表的页面编号，新的过滤器页面在该表的区段中分配
+   * @param nFirstID 第一个过滤器页面的编号
+   * @param iColVec 建立过滤器的整数列
+   */
+  BloomFilter(PageID nOwner, PageID nFirstID,
+              const std::vector<FieldID> &iColVec,
+              const std::vector<FieldType> &iTypeVec,
+              const std::vector<Size> &iSizeVec);
+  ~BloomFilter() = default;
+
+  /**
+   * @brief 将一条记录的键加入数据页面的过滤器
+   *
+   * @param nHeapID 记录原始位置所在的数据页面编号
+   * @param pData VariableRecord::VarStore格式的记录数据
+   */
+  void Add(PageID nHeapID, const uint8_t *pData);
+  /**
+   * @brief 判断数据页面上是否可能存在满足过滤器的记录，未记录的页面总是返回true
+   */
+  bool MayMatch(PageID nHeapID, const RecordFilter &iFilter) const;
+
+  const std::vector<FieldID> &GetColumns() const;
+
+  /**
+   * @brief 判断键是否可能在一个过滤器中
+   *
+   * @param pBits BLOOM_FILTER_BYTES字节的位数组
+   */
+  static bool MayContain(const uint8_t *pBits, int nKey);
+
+ protected:
+  void InitEntry(uint8_t *pEntry) const override;
+
+ private:
+  std::vector<FieldID> _iColVec;
+  /**
+   * @brief 表中每一列在_iColVec中的下标，没有过滤器的列为-1
+   */
+  std::vector<int> _iIndexVec;
+  RecordView _iView;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_BLOOM_FILTER_H_
@@ -0,0 +1,138 @@
+#include "table/free_space_map.h"
+
+#include <algorithm>
+
+#include "macros.h"
+#include "minios/os.h"
+#include "page/free_space_page.h"
+
+namespace thdb {
+
+const Size FREE_SPACE_BUCKETS = 256;
+const Size FREE_SPACE_GROUP = 64;
+
+FreeSpaceMap::FreeSpaceMap(PageID nOwner, PageID nFirstID)
+    : _nOwner(nOwner), _iFirstGroup(FREE_SPACE_BUCKETS, 0) {
+  Size nDataSize = MiniOS::GetOS()->GetDataSize();
+  _nUnit = (nDataSize + FREE_SPACE_BUCKETS - 1) / FREE_SPACE_BUCKETS;
+  PageID nCur = nFirstID;
+  while (nCur != NULL_PAGE) {
+    MiniOS::GetOS()->ReadAhead(nCur);
+    FreeSpacePage iPage(nCur);
+    _iPageVec.push_back(nCur);
+    _iBeginVec.push_back(_iHeapVec.size());
+    for (SlotID i = 0; i < iPage.GetUsed(); ++i) {
+      _iPosMap[iPage.GetHeapID(i)] = _iHeapVec.size();
+      _iHeapVec.push_back(iPage.GetHeapID(i));
+      _iBucketVec.push_back(iPage.GetBucket(i));
+    }
+    nCur = iPage.GetNextID();
+  }
+  _iGroupMax.resize((_iHeapVec.size() + FREE_SPACE_GROUP - 1) /
+                    FREE_SPACE_GROUP);
+  for (Size i = 0; i < _iGroupMax.size(); ++i) RefreshGroup(i);
+}
+
+FreeSpaceMap::~FreeSpaceMap() { Flush(); }
+
+uint8_t FreeSpaceMap::ToBucket(PageOffset nFree) const {
+  return std::min<Size>(nFree / _nUnit, FREE_SPACE_BUCKETS - 1);
+}
+
+void FreeSpaceMap::RefreshGroup(Size nGroup) {
+  Size nBegin = nGroup * FREE_SPACE_GROUP;
+  Size nEnd = std::min<Size>(nBegin + FREE_SPACE_GROUP, _iBucketVec.size());
+  uint8_t nOld = _iGroupMax[nGroup];
+  _iGroupMax[nGroup] = *std::max_element(_iBucketVec.begin() + nBegin,
+                                         _iBucketVec.begin() + nEnd);
+  // 只有新满足的分级可能需要从更靠前的组开始查找
+  for (Size i = nOld + 1; i <= _iGroupMax[nGroup]; ++i)
+    _iFirstGroup[i] = std::min(_iFirstGroup[i], nGroup);
+}
+
+PageID FreeSpaceMap::Find(PageOffset nLen) const {
+  // 分级向下取整，需要的分级向上取整
+  Size nNeed = (nLen + _nUnit - 1) / _nUnit;
+  if (nNeed >= FREE_SPACE_BUCKETS) return NULL_PAGE;
+  for (Size i = _iFirstGroup[nNeed]; i < _iGroupMax.size(); ++i) {
+    if (_iGroupMax[i] < nNeed) continue;
+    _iFirstGroup[nNeed] = i;
+    Size nEnd = std::min<Size>((i + 1) * FREE_SPACE_GROUP, _iBucketVec.size());
+    for (Size j = i * FREE_SPACE_GROUP; j < nEnd; ++j)
+      if (_iBucketVec[j] >= nNeed) return _iHeapVec[j];
+  }
+  _iFirstGroup[nNeed] = _iGroupMax.size();
+  return NULL_PAGE;
+}
+
+void FreeSpaceMap::Update(PageID nHeapID, PageOffset nFree) {
+  auto it = _iPosMap.find(nHeapID);
+  if (it == _iPosMap.end()) return;
+  Size nPos = it->second;
+  uint8_t nBucket = ToBucket(nFree);
+  if (_iBucketVec[nPos] == nBucket) return;
+  _iBucketVec[nPos] = nBucket;
+  RefreshGroup(nPos / FREE_SPACE_GROUP);
+  Size nPage = std::upper_bound(_iBeginVec.begin(), _iBeginVec.end(), nPos) -
+               _iBeginVec.begin() - 1;
+  _iDirtyPages.insert(nPage);
+}
+
+void FreeSpaceMap::Append(PageID nHeapID, PageOffset nFree) {
+  if (_iPosMap.find(nHeapID) != _iPosMap.end()) {
+    Update(nHeapID, nFree);
+    return;
+  }
+  // 新的数据页面立即写入映射页面，保证映射覆盖表中的所有页面
+  uint8_t nBucket = ToBucket(nFree);
+  bool bNewPage = _iPageVec.empty() ||
+                  _iHeapVec.size() - _iBeginVec.back() >=
+                      FreeSpacePage::GetCap();
+  if (bNewPage) {
+    FreeSpacePage *pPage = new FreeSpacePage(_nOwner, NEW_PAGE);
+    pPage->Append(nHeapID, nBucket);
+    if (!_iPageVec.empty()) {
+      FreeSpacePage iLast(_iPageVec.back());
+      iLast.PushBack(pPage);
+    }
+    _iPageVec.push_back(pPage->GetPageID());
+    _iBeginVec.push_back(_iHeapVec.size());
+    delete pPage;
+  } else {
+    FreeSpacePage iPage(_iPageVec.back());
+    iPage.Append(nHeapID, nBucket);
+  }
+  _iPosMap[nHeapID] = _iHeapVec.size();
+  _iHeapVec.push_back(nHeapID);
+  _iBucketVec.push_back(nBucket);
+  if (_iGroupMax.size() * FREE_SPACE_GROUP < _iBucketVec.size())
+    _iGroupMax.push_back(0);
+  RefreshGroup(_iGroupMax.size() - 1);
+}
+
+void FreeSpaceMap::Flush() {
+  for (const auto &nPage : _iDirtyPages) {
+    FreeSpacePage iPage(_iPageVec[nPage]);
+    for (SlotID i = 0; i < iPage.GetUsed(); ++i)
+      iPage.SetBucket(i, _iBucketVec[_iBeginVec[nPage] + i]);
+  }
+  _iDirtyPages.clear();
+}
+
+void FreeSpaceMap::Clear() {
+  for (const auto &nPageID : _iPageVec) MiniOS::GetOS()->DeletePage(nPageID);
+  _iPageVec.clear();
+  _iBeginVec.clear();
+  _iHeapVec.clear();
+  _iBucketVec.clear();
+  _iGroupMax.clear();
+  _iFirstGroup.assign(FREE_SPACE_BUCKETS, 0);
+  _iPosMap.clear();
+  _iDirtyPages.clear();
+}
+
+PageID FreeSpaceMap::GetFirstID() const {
+  return _iPageVec.empty() ? NULL_PAGE : _iPageVec.front();
+}
+
+}  // namespace thdb
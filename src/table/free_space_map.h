@@ -0,0 +1,93 @@
+#ifndef THDB_FREE_SPACE_MAP_H_
+#define THDB_FREE_SPACE_MAP_H_
+
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include "defines.h"
+
+namespace thdb {
+
+/**
+ * @brief 表的空闲空间映射。
+ * 为表中每个数据页面记录1字节的剩余空间分级，持久化在FreeSpacePage组成的链表中，
+ * 打开表时整体读入内存。分级向下取整，分级足够的页面一定能容纳对应长度的记录。
+ * 每64个页面维护一个最大分级，查找可用页面时先跳过最大分级不足的组。
+ * 每个分级另记录查找的起始组，反复插入时不必每次从第一组开始扫描。
+ * 分级的修改在内存中累积，析构或Flush时写回；映射只作为提示，插入前仍会检查页面本身。
+ */
+class FreeSpaceMap {
+ public:
+  /**
+   * @brief 导入以nFirstID开始的空闲空间映射，nFirstID为NULL_PAGE时构建空映射
+   *
+   * @param nOwner 所属表的页面编号，新的映射页面在该表的区段中分配
+   * @param nFirstID 第一个映射页面的编号
+   */
+  FreeSpaceMap(PageID nOwner, PageID nFirstID);
+  ~FreeSpaceMap();
+
+  /**
+   * @brief 查找一个能够容纳长度为nLen的新记录的数据页面
+   *
+   * @param nLen 记录长度
+   * @return PageID 数据页面编号，不存在时返回NULL_PAGE
+   */
+  PageID Find(PageOffset nLen) const;
+  /**
+   * @brief 更新数据页面的剩余空间
+   *
+   * @param nHeapID 数据页面编号
+   * @param nFree 页面能容纳的最长新记录长度
+   */
+  void Update(PageID nHeapID, PageOffset nFree);
+  /**
+   * @brief 为新加入表的数据页面增加记录
+   *
+   * @param nHeapID 数据页面编号
+   * @param nFree 页面能容纳的最长新记录长度
+   */
+  void Append(PageID nHeapID, PageOffset nFree);
+  /**
+   * @brief 将内存中修改过的分级写回映射页面
+   */
+  void Flush();
+  /**
+   * @brief 释放全部映射页面
+   */
+  void Clear();
+
+  PageID GetFirstID() const;
+
+ private:
+  uint8_t ToBucket(PageOffset nFree) const;
+  void RefreshGroup(Size nGroup);
+
+  PageID _nOwner;
+  /**
+   * @brief 每一级分级代表的字节数
+   */
+  Size _nUnit;
+  /**
+   * @brief 映射页面编号，以及每个映射页面第一条记录的全局位置
+   */
+  std::vector<PageID> _iPageVec;
+  std::vector<Size> _iBeginVec;
+  std::vector<PageID> _iHeapVec;
+  std::vector<uint8_t> _iBucketVec;
+  std::vector<uint8_t> _iGroupMax;
+  /**
+   * @brief 每个分级查找的起始组，之前各组的最大分级均低于该分级
+   */
+  mutable std::vector<Size> _iFirstGroup;
+  std::unordered_map<PageID, Size> _iPosMap;
+  /**
+   * @brief 分级被修改但尚未写回的映射页面下标
+   */
+  std::set<Size> _iDirtyPages;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_FREE_SPACE_MAP_H_
@@ -0,0 +1,111 @@
+#include "table/page_summary.h"
+
+#include <algorithm>
+
+#include "macros.h"
+#include "minios/os.h"
+#include "page/summary_page.h"
+
+namespace thdb {
+
+PageSummary::PageSummary(PageID nOwner, PageID nFirstID, Size nEntrySize)
+    : _nEntrySize(nEntrySize), _nOwner(nOwner) {
+  PageID nCur = nFirstID;
+  while (nCur != NULL_PAGE) {
+    MiniOS::GetOS()->ReadAhead(nCur);
+    SummaryPage iPage(nCur, _nEntrySize);
+    _iPageVec.push_back(nCur);
+    _iBeginVec.push_back(_iHeapVec.size());
+    for (SlotID i = 0; i < iPage.GetUsed(); ++i) {
+      _iPosMap[iPage.GetHeapID(i)] = _iHeapVec.size();
+      _iHeapVec.push_back(iPage.GetHeapID(i));
+      const uint8_t *pEntry = iPage.GetEntry(i);
+      _iEntryVec.insert(_iEntryVec.end(), pEntry, pEntry + _nEntrySize);
+    }
+    nCur = iPage.GetNextID();
+  }
+}
+
+PageSummary::~PageSummary() { Flush(); }
+
+void PageSummary::Append(PageID nHeapID) {
+  if (_iPosMap.find(nHeapID) != _iPosMap.end()) return;
+  std::vector<uint8_t> iEntry(_nEntrySize);
+  InitEntry(iEntry.data());
+  // 新的数据页面立即写入摘要页面，保证摘要覆盖表中的所有页面
+  bool bNewPage = _iPageVec.empty() || _iHeapVec.size() - _iBeginVec.back() >=
+                                           SummaryPage::GetCap(_nEntrySize);
+  if (bNewPage) {
+    SummaryPage *pPage = new SummaryPage(_nOwner, _nEntrySize, NEW_PAGE);
+    pPage->Append(nHeapID, iEntry.data());
+    if (!_iPageVec.empty()) {
+      SummaryPage iLast(_iPageVec.back(), _nEntrySize);
+      iLast.PushBack(pPage);
+    }
+    _iPageVec.push_back(pPage->GetPageID());
+    _iBeginVec.push_back(_iHeapVec.size());
+    delete pPage;
+  } else {
+    SummaryPage iPage(_iPageVec.back(), _nEntrySize);
+    iPage.Append(nHeapID, iEntry.data());
+  }
+  _iPosMap[nHeapID] = _iHeapVec.size();
+  _iHeapVec.push_back(nHeapID);
+  _iEntryVec.insert(_iEntryVec.end(), iEntry.begin(), iEntry.end());
+}
+
+const uint8_t *PageSummary::GetEntry(PageID nHeapID) const {
+  auto it = _iPosMap.find(nHeapID);
+  if (it == _iPosMap.end()) return nullptr;
+  return _iEntryVec.data() + _nEntrySize * it->second;
+}
+
+uint8_t *PageSummary::GetMutableEntry(PageID nHeapID) {
+  auto it = _iPosMap.find(nHeapID);
+  if (it == _iPosMap.end()) return nullptr;
+  return _iEntryVec.data() + _nEntrySize * it->second;
+}
+
+void PageSummary::SetDirty(PageID nHeapID) {
+  auto it = _iPosMap.find(nHeapID);
+  if (it == _iPosMap.end()) return;
+  Size nPage = std::upper_bound(_iBeginVec.begin(), _iBeginVec.end(),
+                                it->second) -
+               _iBeginVec.begin() - 1;
+  _iDirtyPages.insert(nPage);
+}
+
+PageID PageSummary::GetNextID(PageID nHeapID) const {
+  auto it = _iPosMap.find(nHeapID);
+  if (it == _iPosMap.end() || it->second + 1 >= _iHeapVec.size())
+    return NULL_PAGE;
+  return _iHeapVec[it->second + 1];
+}
+
+void PageSummary::Flush() {
+  for (const auto &nPage : _iDirtyPages) {
+    SummaryPage iPage(_iPageVec[nPage], _nEntrySize);
+    for (SlotID i = 0; i < iPage.GetUsed(); ++i)
+      iPage.SetEntry(
+          i, _iEntryVec.data() + _nEntrySize * (_iBeginVec[nPage] + i));
+  }
+  _iDirtyPages.clear();
+}
+
+void PageSummary::Clear() {
+  for (const auto &nPageID : _iPageVec) MiniOS::GetOS()->DeletePage(nPageID);
+  _iPageVec.clear();
+  _iBeginVec.clear();
+  _iHeapVec.clear();
+  _iEntryVec.clear();
+  _iPosMap.clear();
+  _iDirtyPages.clear();
+}
+
+PageID PageSummary::GetFirstID() const {
+  return _iPageVec.empty() ? NULL_PAGE : _iPageVec.front();
+}
+
+std::vector<PageID> PageSummary::GetPageVec() const { return _iPageVec; }
+
+}  // namespace thdb
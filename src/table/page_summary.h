@@ -0,0 +1,90 @@
+#ifndef THDB_PAGE_SUMMARY_H_
+#define THDB_PAGE_SUMMARY_H_
+
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include "defines.h"
+
+namespace thdb {
+
+/**
+ * @brief 表中各数据页面的定长摘要。
+ * 摘要持久化在SummaryPage组成的链表中，打开表时整体读入内存，
+ * 按表页面链表的顺序排列。摘要以记录的原始位置所在页面为准，
+ * 迁出的记录计入原始页面。修改在内存中累积，析构或Flush时写回。
+ * 子类负责解释摘要的内容。
+ */
+class PageSummary {
+ public:
+  /**
+   * @brief 导入以nFirstID开始的摘要，nFirstID为NULL_PAGE时构建空摘要
+   *
+   * @param nOwner 所属表的页面编号，新的摘要页面在该表的区段中分配
+   * @param nFirstID 第一个摘要页面的编号
+   * @param nEntrySize 每个数据页面摘要的字节数
+   */
+  PageSummary(PageID nOwner, PageID nFirstID, Size nEntrySize);
+  virtual ~PageSummary();
+
+  /**
+   * @brief 为新加入表的数据页面增加一个初始摘要
+   */
+  void Append(PageID nHeapID);
+  /**
+   * @brief 获得页面链表中的下一个数据页面，
+   * 页面未记录或是最后一个页面时返回NULL_PAGE
+   */
+  PageID GetNextID(PageID nHeapID) const;
+  /**
+   * @brief 将内存中修改过的摘要写回摘要页面
+   */
+  void Flush();
+  /**
+   * @brief 释放全部摘要页面
+   */
+  void Clear();
+
+  PageID GetFirstID() const;
+  /**
+   * @brief 获得全部摘要页面的编号
+   */
+  std::vector<PageID> GetPageVec() const;
+
+ protected:
+  /**
+   * @brief 填写新数据页面的初始摘要
+   */
+  virtual void InitEntry(uint8_t *pEntry) const = 0;
+  /**
+   * @brief 获得数据页面的摘要，页面未记录时返回nullptr
+   */
+  const uint8_t *GetEntry(PageID nHeapID) const;
+  /**
+   * @brief 获得可修改的摘要，修改后需调用SetDirty
+   */
+  uint8_t *GetMutableEntry(PageID nHeapID);
+  void SetDirty(PageID nHeapID);
+
+  Size _nEntrySize;
+
+ private:
+  PageID _nOwner;
+  /**
+   * @brief 摘要页面编号，以及每个摘要页面第一条记录的全局位置
+   */
+  std::vector<PageID> _iPageVec;
+  std::vector<Size> _iBeginVec;
+  std::vector<PageID> _iHeapVec;
+  std::vector<uint8_t> _iEntryVec;
+  std::unordered_map<PageID, Size> _iPosMap;
+  /**
+   * @brief 摘要被修改但尚未写回的摘要页面下标
+   */
+  std::set<Size> _iDirtyPages;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_PAGE_SUMMARY_H_
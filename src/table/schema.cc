@@ -2,10 +2,13 @@
 
 namespace thdb {
 
-Schema::Schema(const std::vector<Column> &iColVec) : _iColVec(iColVec) {}
+Schema::Schema(const std::vector<Column> &iColVec, TableLayout iLayout)
+    : _iColVec(iColVec), _iLayout(iLayout) {}
 
 Size Schema::GetSize() const { return _iColVec.size(); }
 
 Column Schema::GetColumn(Size nPos) const { return _iColVec[nPos]; }
 
+TableLayout Schema::GetLayout() const { return _iLayout; }
+
 }  // namespace thdb
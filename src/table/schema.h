@@ -6,16 +6,38 @@
 
 namespace thdb {
 
+/**
+ * @brief 表的数据页面布局
+ */
+enum class TableLayout {
+  /**
+   * @brief 按行存放变长记录的ToastPage
+   */
+  ROW = 0,
+  /**
+   * @brief 按列分小页存放定长值的PaxPage，适合只读取少数列的扫描
+   */
+  COLUMNAR = 1,
+  /**
+   * @brief 按槽编号直接定位定长记录的RecordPage，
+   * 所有列均为定长的数值列时由ROW自动改为该布局
+   */
+  FIXED = 2
+};
+
 class Schema {
  public:
-  Schema(const std::vector<Column> &iColVec);
+  Schema(const std::vector<Column> &iColVec,
+         TableLayout iLayout = TableLayout::ROW);
   ~Schema() = default;
 
   Size GetSize() const;
   Column GetColumn(Size nPos) const;
+  TableLayout GetLayout() const;
 
  private:
   std::vector<Column> _iColVec;
+  TableLayout _iLayout;
 };
 
 }  // namespace thdb
@@ -7,30 +7,79 @@
 #include "exception/exceptions.h"
 #include "macros.h"
 #include "minios/os.h"
+#include "page/overflow_page.h"
+#include "page/pax_page.h"
 #include "page/record_page.h"
+#include "page/summary_page.h"
 #include "page/toast_page.h"
 #include "record/fixed_record.h"
-#include "record/variable_record.h"
+#include "settings.h"
+#include "table/table_scan_cursor.h"
 
 namespace thdb {
 
-PageID NextPageID(PageID nCur) {
-  LinkedPage *pPage = new LinkedPage(nCur);
-  PageID nNext = pPage->GetNextID();
-  delete pPage;
-  return nNext;
-}
+PageID NextPageID(PageID nCur) { return LinkedPage(nCur).GetNextID(); }
 
 Table::Table(PageID nTableID) {
   pTable = new TablePage(nTableID);
 
   _nHeadID = pTable->GetHeadID();
   _nTailID = pTable->GetTailID();
-  _nNotFull = _nHeadID;
-  NextNotFull(1);
+  // 打开表时不遍历页面链表，插入时若尾页已满再由空闲空间映射查找
+  _nNotFull = _nTailID;
+  auto iTypeVec = pTable->GetTypeVec();
+  _bHasString = std::find(iTypeVec.begin(), iTypeVec.end(),
+                          FieldType::STRING_TYPE) != iTypeVec.end();
+  _bColumnar = (pTable->GetLayout() == TableLayout::COLUMNAR);
+  _bFixed = (pTable->GetLayout() == TableLayout::FIXED);
+  if (pTable->GetFreeSpaceID() == 0) {
+    BuildFreeSpace();
+  } else {
+    _pFreeSpace =
+        new FreeSpaceMap(pTable->GetPageID(), pTable->GetFreeSpaceID());
+  }
+  _pZoneMap = nullptr;
+  _pBloomFilter = nullptr;
+  if (!ZoneMap::HasNumeric(iTypeVec)) return;
+  if (pTable->GetZoneMapID() == 0) {
+    BuildZoneMap();
+  } else {
+    _pZoneMap = new ZoneMap(pTable->GetPageID(), pTable->GetZoneMapID(),
+                            iTypeVec, pTable->GetSizeVec());
+    // 上次关闭前未能写回的映射可能漏掉部分记录，扫描全表重新构建
+    if (pTable->IsSummaryStale()) {
+      _pZoneMap->Clear();
+      delete _pZoneMap;
+      BuildZoneMap();
+    }
+  }
+  if (pTable->GetBloomFilterID() != 0) {
+    _pBloomFilter = new BloomFilter(
+        pTable->GetPageID(), pTable->GetBloomFilterID(),
+        pTable->GetBloomColumns(), iTypeVec, pTable->GetSizeVec());
+    if (pTable->IsSummaryStale()) BuildBloomFilter(pTable->GetBloomColumns());
+  }
 }
 
-Table::~Table() { delete pTable; }
+Table::~Table() {
+  std::vector<PageID> iSummaryVec;
+  if (_pBloomFilter) {
+    iSummaryVec = _pBloomFilter->GetPageVec();
+    delete _pBloomFilter;
+  }
+  if (_pZoneMap) {
+    std::vector<PageID> iZoneVec = _pZoneMap->GetPageVec();
+    iSummaryVec.insert(iSummaryVec.end(), iZoneVec.begin(), iZoneVec.end());
+    delete _pZoneMap;
+  }
+  if (pTable->IsSummaryStale()) {
+    // 摘要页面持久化之后才能清除标记，标记本身随表页面正常写回
+    MiniOS::GetOS()->SyncPages(iSummaryVec);
+    pTable->SetSummaryStale(false);
+  }
+  delete _pFreeSpace;
+  delete pTable;
+}
 
 Record *Table::GetRecord(PageID nPageID, SlotID nSlotID) {
   // LAB1 BEGIN
@@ -40,10 +89,45 @@ Record *Table::GetRecord(PageID nPageID, SlotID nSlotID) {
   // GetSizeVec三个函数可以构建空的FixedRecord对象 TIPS:
   // 利用Record::Load导入数据 ALERT: 需要注意析构所有不会返回的内容
   // LAB1 END
-  ToastPage page(nPageID);
-  uint8_t *data = page.GetRecord(nSlotID);
+  std::vector<FieldID> iDetoast(pTable->GetFieldSize());
+  for (FieldID i = 0; i < iDetoast.size(); ++i) iDetoast[i] = i;
+  std::vector<ToastPointer> iExternal;
+  return LoadRecord(nPageID, nSlotID, iDetoast, iExternal);
+}
+
+Record *Table::GetRecord(PageID nPageID, SlotID nSlotID,
+                         const std::vector<FieldID> &iDetoast) {
+  std::vector<ToastPointer> iExternal;
+  return LoadRecord(nPageID, nSlotID, iDetoast, iExternal);
+}
+
+VariableRecord *Table::LoadRecord(PageID nPageID, SlotID nSlotID,
+                                  const std::vector<FieldID> &iDetoast,
+                                  std::vector<ToastPointer> &iExternal) {
   VariableRecord *pRecord = (VariableRecord *)EmptyRecord();
-  pRecord->VarLoad(data);
+  if (_bColumnar) {
+    std::vector<uint8_t> iData;
+    PaxPage page(nPageID, pTable->GetTypeVec(), pTable->GetSizeVec());
+    page.GetRecord(nSlotID, iData);
+    pRecord->VarLoad(iData.data(), iDetoast, iExternal);
+    return pRecord;
+  }
+  if (_bFixed) {
+    RecordPage page(nPageID);
+    pRecord->VarLoad(page.ViewRecord(nSlotID), iDetoast, iExternal);
+    return pRecord;
+  }
+  PageSlotID iTarget;
+  {
+    ToastPage page(nPageID);
+    if (!page.IsRedirect(nSlotID)) {
+      pRecord->VarLoad(page.ViewRecord(nSlotID), iDetoast, iExternal);
+      return pRecord;
+    }
+    iTarget = page.GetRedirect(nSlotID);
+  }
+  ToastPage page(iTarget.first);
+  pRecord->VarLoad(page.ViewRecord(iTarget.second), iDetoast, iExternal);
   return pRecord;
 }
 
@@ -55,23 +139,36 @@ PageSlotID Table::InsertRecord(Record *pRecord) {
   // TIPS: 利用RecordPage::InsertRecord插入数据
   // TIPS: 注意页满时更新_nNotFull
   // LAB1 END
-  VariableRecord *record = (VariableRecord *)pRecord;
-  PageOffset len = record->GetTotSize();
-  uint8_t *data = new uint8_t[DATA_SIZE];
-  record->VarStore(data);
+  return InsertBatch({pRecord})[0];
+}
 
-  ToastPage *page = new ToastPage(_nNotFull);
-  if (page->Full(len)) {
+std::vector<PageSlotID> Table::InsertBatch(
+    const std::vector<Record *> &iRecordVec) {
+  BeginSummaryUpdate();
+  if (_bColumnar) return InsertPax(iRecordVec);
+  if (_bFixed) return InsertFixed(iRecordVec);
+  std::vector<PageSlotID> iPairs;
+  iPairs.reserve(iRecordVec.size());
+  std::vector<uint8_t> iData(MiniOS::GetOS()->GetDataSize());
+  ToastPage *page = nullptr;
+  for (const auto &pRecord : iRecordVec) {
+    PageOffset len = Serialize((VariableRecord *)pRecord, iData);
+    if (page == nullptr) page = new ToastPage(_nNotFull);
+    if (page->Full(len)) {
+      _pFreeSpace->Update(page->GetPageID(), page->GetFreeSize());
+      delete page;
+      NextNotFull(len);
+      page = new ToastPage(_nNotFull);
+    }
+    SlotID slot_id = page->InsertRecord(iData.data(), len);
+    iPairs.push_back(PageSlotID(page->GetPageID(), slot_id));
+    Summarize(page->GetPageID(), iData.data());
+  }
+  if (page != nullptr) {
+    _pFreeSpace->Update(page->GetPageID(), page->GetFreeSize());
     delete page;
-    NextNotFull(len);
-    page = new ToastPage(_nNotFull);
-  }
-  PageID page_id = page->GetPageID();
-  SlotID slot_id = page->InsertRecord(data, len);
-  std::pair<PageID, SlotID> ans(page_id, slot_id);
-  delete[] data;
-  delete page;
-  return ans;
+  }
+  return iPairs;
 }
 
 void Table::DeleteRecord(PageID nPageID, SlotID nSlotID) {
@@ -79,8 +176,36 @@ void Table::DeleteRecord(PageID nPageID, SlotID nSlotID) {
   // TIPS: 利用RecordPage::DeleteRecord插入数据
   // TIPS: 注意更新_nNotFull来保证较高的页面空间利用效率
   // LAB1 END
-  ToastPage page(nPageID);
-  page.DeleteRecord(nSlotID);
+  pTable->SetDeletedCount(pTable->GetDeletedCount() + 1);
+  if (_bColumnar) {
+    PaxPage page(nPageID, pTable->GetTypeVec(), pTable->GetSizeVec());
+    page.DeleteRecord(nSlotID);
+    _pFreeSpace->Update(nPageID, page.GetFreeSize());
+    _nNotFull = nPageID;
+    return;
+  }
+  if (_bFixed) {
+    RecordPage page(nPageID);
+    page.DeleteRecord(nSlotID);
+    _pFreeSpace->Update(nPageID, page.GetFreeSize());
+    _nNotFull = nPageID;
+    return;
+  }
+  std::vector<PageID> iChains = GetChains(nPageID, nSlotID);
+  PageSlotID iTarget(NULL_PAGE, 0);
+  {
+    ToastPage page(nPageID);
+    if (page.IsRedirect(nSlotID)) iTarget = page.GetRedirect(nSlotID);
+    page.DeleteRecord(nSlotID);
+    _pFreeSpace->Update(nPageID, page.GetFreeSize());
+  }
+  // 转发槽指向的记录随原始槽一起删除
+  if (iTarget.first != NULL_PAGE) {
+    ToastPage page(iTarget.first);
+    page.DeleteRecord(iTarget.second);
+    _pFreeSpace->Update(iTarget.first, page.GetFreeSize());
+  }
+  for (const auto &nChain : iChains) OverflowPage::FreeChain(nChain);
   _nNotFull = nPageID;
 }
 
@@ -93,30 +218,92 @@ void Table::UpdateRecord(PageID nPageID, SlotID nSlotID,
   // TIPS: 将新的记录序列化
   // TIPS: 利用RecordPage::UpdateRecord更新一条数据
   // LAB1 END
-  VariableRecord *record = (VariableRecord *)GetRecord(nPageID, nSlotID);
-  int old_len = record->GetTotSize();
+  BeginSummaryUpdate();
+  // 只有被修改的字段需要新的内容，其余溢出字段保留指针，不读回也不重新移出
+  std::vector<ToastPointer> iKept;
+  VariableRecord *record = LoadRecord(nPageID, nSlotID, {}, iKept);
   for (Transform trans : iTrans) {
     record->SetField(trans.GetPos(), trans.GetField());
+    iKept[trans.GetPos()].nPageID = NULL_PAGE;
   }
-  PageOffset len = record->GetTotSize();
-  uint8_t *data = new uint8_t[DATA_SIZE];
-  record->VarStore(data);
-
-  ToastPage *page = new ToastPage(nPageID);
-  if (len <= old_len) {
-    page->UpdateRecord(nSlotID, data, len);
-  } else {
-    page->DeleteRecord(nSlotID);
-    if (page->Full(len - old_len)) {
-      delete page;
-      NextNotFull(len);
-      page = new ToastPage(_nNotFull);
-    }
-    page->InsertRecord(data, len);
+  if (_bColumnar) {
+    // 各列定长存放，更新总是原地完成
+    std::vector<uint8_t> iData(record->GetTotSize());
+    record->VarStore(iData.data());
+    delete record;
+    Summarize(nPageID, iData.data());
+    PaxPage page(nPageID, pTable->GetTypeVec(), pTable->GetSizeVec());
+    page.UpdateRecord(nSlotID, iData.data());
+    return;
+  }
+  if (_bFixed) {
+    std::vector<uint8_t> iData(pTable->GetFixedSize());
+    record->VarStore(iData.data());
+    delete record;
+    Summarize(nPageID, iData.data());
+    RecordPage page(nPageID);
+    page.UpdateRecord(nSlotID, iData.data());
+    return;
   }
-  delete[] data;
-  delete page;
+  std::vector<PageID> iChains = GetChains(nPageID, nSlotID);
+  std::vector<uint8_t> iData;
+  PageOffset len = Serialize(record, iData, iKept);
   delete record;
+  // 范围计入原始页面，记录迁出后扫描仍经由原始页面读到它
+  Summarize(nPageID, iData.data());
+  StoreUpdated(nPageID, nSlotID, iData.data(), len);
+
+  // 新记录写入后再释放不再被引用的旧溢出页面链
+  for (const auto &nChain : iChains) {
+    bool bKept = false;
+    for (const auto &iPointer : iKept)
+      if (iPointer.nPageID == nChain) bKept = true;
+    if (!bKept) OverflowPage::FreeChain(nChain);
+  }
+}
+
+void Table::StoreUpdated(PageID nPageID, SlotID nSlotID, const uint8_t *src,
+                         PageOffset len) {
+  // 记录始终通过原始槽访问，变长后放不下时迁出到其他页面并留下转发槽
+  PageSlotID iTarget(NULL_PAGE, 0);
+  {
+    ToastPage page(nPageID);
+    if (page.IsRedirect(nSlotID)) iTarget = page.GetRedirect(nSlotID);
+  }
+  if (iTarget.first != NULL_PAGE) {
+    if (UpdateInPage(iTarget.first, iTarget.second, src, len)) return;
+    // 迁出的页面也放不下，释放旧副本后优先尝试搬回原始页面
+    ToastPage page(iTarget.first);
+    page.DeleteRecord(iTarget.second);
+    _pFreeSpace->Update(iTarget.first, page.GetFreeSize());
+  }
+  if (UpdateInPage(nPageID, nSlotID, src, len)) return;
+  {
+    // 先确认原始槽能写入转发头，避免迁出的副本成为无人引用的记录
+    ToastPage page(nPageID);
+    if (!page.CanRedirect(nSlotID)) throw ToastPageFullException();
+  }
+
+  NextNotFull(len + FORWARD_SIZE);
+  {
+    ToastPage page(_nNotFull);
+    iTarget = PageSlotID(_nNotFull,
+                         page.InsertMovedRecord(src, len,
+                                                PageSlotID(nPageID, nSlotID)));
+    _pFreeSpace->Update(_nNotFull, page.GetFreeSize());
+  }
+  ToastPage page(nPageID);
+  page.SetRedirect(nSlotID, iTarget);
+  _pFreeSpace->Update(nPageID, page.GetFreeSize());
+}
+
+bool Table::UpdateInPage(PageID nPageID, SlotID nSlotID, const uint8_t *src,
+                         PageOffset len) {
+  ToastPage page(nPageID);
+  if (!page.CanUpdate(nSlotID, len)) return false;
+  page.UpdateRecord(nSlotID, src, len);
+  _pFreeSpace->Update(nPageID, page.GetFreeSize());
+  return true;
 }
 
 std::vector<PageSlotID> Table::SearchRecord(Condition *pCond) {
@@ -127,24 +314,9 @@ std::vector<PageSlotID> Table::SearchRecord(Condition *pCond) {
   // TIPS: Condition的抽象方法Match可以判断Record是否满足检索条件
   // TIPS: 返回所有符合条件的结果的pair<PageID,SlotID>
   // LAB1 END
-  PageID nCur = _nHeadID;
   std::vector<PageSlotID> ans;
-  while (nCur != NULL_PAGE) {
-    ToastPage page(nCur);
-    uint32_t tested = 0, nSlot = 0;
-    while (tested < page.GetUsed()) {
-      if (page.HasRecord(nSlot)) {
-        Record *record = GetRecord(nCur, nSlot);
-        if (!pCond || pCond->Match(*record)) {
-          ans.push_back(PageSlotID(nCur, nSlot));
-        }
-        tested += 1;
-        delete record;
-      }
-      nSlot += 1;
-    }
-    nCur = NextPageID(nCur);
-  }
+  TableScanCursor iCursor(this, pCond);
+  while (iCursor.Next()) ans.push_back(iCursor.GetPageSlotID());
   return ans;
 }
 
@@ -162,12 +334,32 @@ void Table::SearchRecord(std::vector<PageSlotID> &iPairs, Condition *pCond) {
 }
 
 void Table::Clear() {
+  std::vector<PageID> iChains;
+  if (_bHasString && !_bColumnar) {
+    TableScanCursor iCursor(this, nullptr);
+    while (iCursor.Next()) CollectChains(iCursor.GetView(), iChains);
+  }
+  for (const auto &nChain : iChains) OverflowPage::FreeChain(nChain);
   PageID nBegin = _nHeadID;
   while (nBegin != NULL_PAGE) {
     PageID nTemp = nBegin;
+    MiniOS::GetOS()->ReadAhead(nBegin);
     nBegin = NextPageID(nBegin);
     MiniOS::GetOS()->DeletePage(nTemp);
   }
+  _pFreeSpace->Clear();
+  pTable->SetFreeSpaceID(0);
+  if (_pZoneMap) {
+    _pZoneMap->Clear();
+    pTable->SetZoneMapID(0);
+  }
+  if (_pBloomFilter) {
+    _pBloomFilter->Clear();
+    pTable->SetBloomFilterID(0);
+  }
+  // 表已清空，析构时无需再持久化摘要
+  pTable->SetSummaryStale(false);
+  MiniOS::GetOS()->ReleaseExtent(pTable->GetPageID());
 }
 
 void Table::NextNotFull(const PageOffset len) {
@@ -181,24 +373,439 @@ void Table::NextNotFull(const PageOffset len) {
   // 充分利用链表性质，注意全满时需要在结尾_pTable->GetTailID对应结点后插入新的结点，并更新_pTable的TailID
   // TIPS: 只需要保证均摊复杂度较低即可
   // LAB1 END
+  PageID nFound = _pFreeSpace->Find(len);
+  while (nFound != NULL_PAGE) {
+    PageOffset nFree = 0;
+    if (PageFits(nFound, len, nFree)) {
+      _nNotFull = nFound;
+      return;
+    }
+    // 空闲空间映射只是提示，与页面实际情况不符时修正后继续查找
+    _pFreeSpace->Update(nFound, nFree);
+    nFound = _pFreeSpace->Find(len);
+  }
+  LinkedPage *newPage = nullptr;
+  PageOffset nFree = 0;
+  if (_bColumnar) {
+    PaxPage *pPage = new PaxPage(pTable->GetPageID(), pTable->GetTypeVec(),
+                                 pTable->GetSizeVec(), NEW_PAGE);
+    nFree = pPage->GetFreeSize();
+    newPage = pPage;
+  } else if (_bFixed) {
+    RecordPage *pPage =
+        new RecordPage(pTable->GetPageID(), pTable->GetFixedSize(), NEW_PAGE);
+    nFree = pPage->GetFreeSize();
+    newPage = pPage;
+  } else {
+    ToastPage *pPage = new ToastPage(pTable->GetPageID(), NEW_PAGE);
+    nFree = pPage->GetFreeSize();
+    newPage = pPage;
+  }
+  LinkedPage page(_nTailID);
+  page.PushBack(newPage);
+  pTable->SetTailID(newPage->GetPageID());
+  _nTailID = pTable->GetTailID();
+  _nNotFull = _nTailID;
+  _pFreeSpace->Append(_nTailID, nFree);
+  AppendSummary(_nTailID);
+  delete newPage;
+}
+
+bool Table::PageFits(PageID nPageID, PageOffset len, PageOffset &nFree) const {
+  if (_bColumnar) {
+    PaxPage page(nPageID, pTable->GetTypeVec(), pTable->GetSizeVec());
+    nFree = page.GetFreeSize();
+    return !page.Full();
+  }
+  if (_bFixed) {
+    RecordPage page(nPageID);
+    nFree = page.GetFreeSize();
+    return !page.Full();
+  }
+  ToastPage page(nPageID);
+  nFree = page.GetFreeSize();
+  return !page.Full(len);
+}
+
+std::vector<PageSlotID> Table::InsertPax(
+    const std::vector<Record *> &iRecordVec) {
+  std::vector<PageSlotID> iPairs;
+  iPairs.reserve(iRecordVec.size());
+  std::vector<uint8_t> iData;
+  PaxPage *page = nullptr;
+  for (const auto &pRecord : iRecordVec) {
+    VariableRecord *record = (VariableRecord *)pRecord;
+    iData.resize(record->GetTotSize());
+    record->VarStore(iData.data());
+    if (page == nullptr)
+      page = new PaxPage(_nNotFull, pTable->GetTypeVec(), pTable->GetSizeVec());
+    if (page->Full()) {
+      _pFreeSpace->Update(page->GetPageID(), page->GetFreeSize());
+      delete page;
+      NextNotFull(pTable->GetTotalSize());
+      page = new PaxPage(_nNotFull, pTable->GetTypeVec(), pTable->GetSizeVec());
+    }
+    SlotID slot_id = page->InsertRecord(iData.data());
+    iPairs.push_back(PageSlotID(page->GetPageID(), slot_id));
+    Summarize(page->GetPageID(), iData.data());
+  }
+  if (page != nullptr) {
+    _pFreeSpace->Update(page->GetPageID(), page->GetFreeSize());
+    delete page;
+  }
+  return iPairs;
+}
+
+std::vector<PageSlotID> Table::InsertFixed(
+    const std::vector<Record *> &iRecordVec) {
+  std::vector<PageSlotID> iPairs;
+  iPairs.reserve(iRecordVec.size());
+  Size nFixed = pTable->GetFixedSize();
+  std::vector<uint8_t> iData(nFixed);
+  RecordPage *page = nullptr;
+  for (const auto &pRecord : iRecordVec) {
+    ((VariableRecord *)pRecord)->VarStore(iData.data());
+    if (page == nullptr) page = new RecordPage(_nNotFull);
+    if (page->Full()) {
+      _pFreeSpace->Update(page->GetPageID(), page->GetFreeSize());
+      delete page;
+      NextNotFull(nFixed);
+      page = new RecordPage(_nNotFull);
+    }
+    SlotID slot_id = page->InsertRecord(iData.data());
+    iPairs.push_back(PageSlotID(page->GetPageID(), slot_id));
+    Summarize(page->GetPageID(), iData.data());
+  }
+  if (page != nullptr) {
+    _pFreeSpace->Update(page->GetPageID(), page->GetFreeSize());
+    delete page;
+  }
+  return iPairs;
+}
+
+void Table::BuildFreeSpace() {
+  _pFreeSpace = new FreeSpaceMap(pTable->GetPageID(), NULL_PAGE);
+  PageID nCur = _nHeadID;
+  while (nCur != NULL_PAGE) {
+    MiniOS::GetOS()->ReadAhead(nCur);
+    PageOffset nFree = 0;
+    PageFits(nCur, 0, nFree);
+    _pFreeSpace->Append(nCur, nFree);
+    nCur = NextPageID(nCur);
+  }
+  pTable->SetFreeSpaceID(_pFreeSpace->GetFirstID());
+}
+
+void Table::BuildZoneMap() {
+  _pZoneMap = new ZoneMap(pTable->GetPageID(), NULL_PAGE, pTable->GetTypeVec(),
+                          pTable->GetSizeVec());
   PageID nCur = _nHeadID;
   while (nCur != NULL_PAGE) {
-    ToastPage page(nCur);
-    if (!page.Full(len)) {
-      _nNotFull = nCur;
+    MiniOS::GetOS()->ReadAhead(nCur);
+    _pZoneMap->Append(nCur);
+    nCur = NextPageID(nCur);
+  }
+  // 游标按原始位置返回记录，迁出的记录自然计入原始页面
+  TableScanCursor iCursor(this, nullptr);
+  while (iCursor.Next())
+    _pZoneMap->Widen(iCursor.GetPageSlotID().first,
+                     iCursor.GetView().GetData());
+  pTable->SetZoneMapID(_pZoneMap->GetFirstID());
+}
+
+void Table::BuildBloomFilter(const std::vector<FieldID> &iColVec) {
+  if (_pBloomFilter) {
+    _pBloomFilter->Clear();
+    delete _pBloomFilter;
+    _pBloomFilter = nullptr;
+  }
+  pTable->SetBloomColumns(iColVec);
+  pTable->SetBloomFilterID(0);
+  if (iColVec.empty()) return;
+  // 列集合改变后每个页面的过滤器长度随之改变，整体重新构建
+  _pBloomFilter =
+      new BloomFilter(pTable->GetPageID(), NULL_PAGE, iColVec,
+                      pTable->GetTypeVec(), pTable->GetSizeVec());
+  PageID nCur = _nHeadID;
+  while (nCur != NULL_PAGE) {
+    MiniOS::GetOS()->ReadAhead(nCur);
+    _pBloomFilter->Append(nCur);
+    nCur = NextPageID(nCur);
+  }
+  TableScanCursor iCursor(this, nullptr);
+  while (iCursor.Next())
+    _pBloomFilter->Add(iCursor.GetPageSlotID().first,
+                       iCursor.GetView().GetData());
+  pTable->SetBloomFilterID(_pBloomFilter->GetFirstID());
+}
+
+void Table::AppendSummary(PageID nHeapID) {
+  if (_pZoneMap) _pZoneMap->Append(nHeapID);
+  if (_pBloomFilter) _pBloomFilter->Append(nHeapID);
+}
+
+void Table::Summarize(PageID nHeapID, const uint8_t *pData) {
+  if (_pZoneMap) _pZoneMap->Widen(nHeapID, pData);
+  if (_pBloomFilter) _pBloomFilter->Add(nHeapID, pData);
+}
+
+void Table::BeginSummaryUpdate() {
+  if ((!_pZoneMap && !_pBloomFilter) || pTable->IsSummaryStale()) return;
+  pTable->SetSummaryStale(true);
+  pTable->Store();
+  MiniOS::GetOS()->SyncPages({pTable->GetPageID()});
+}
+
+bool Table::SkipPage(PageID nHeapID, const RecordFilter &iFilter,
+                     PageID &nNextID) const {
+  if (_pZoneMap && !_pZoneMap->MayMatch(nHeapID, iFilter)) {
+    nNextID = _pZoneMap->GetNextID(nHeapID);
+    return true;
+  }
+  if (_pBloomFilter && !_pBloomFilter->MayMatch(nHeapID, iFilter)) {
+    nNextID = _pBloomFilter->GetNextID(nHeapID);
+    return true;
+  }
+  return false;
+}
+
+bool Table::AddBloomFilter(FieldID nPos) {
+  if (pTable->GetTypeVec()[nPos] != FieldType::INT_TYPE) return false;
+  if (HasBloomFilter(nPos)) return false;
+  std::vector<FieldID> iColVec = pTable->GetBloomColumns();
+  iColVec.push_back(nPos);
+  // 每个摘要页面至少要容纳一个数据页面的全部过滤器
+  if (SummaryPage::GetCap(BLOOM_FILTER_BYTES * iColVec.size()) == 0)
+    return false;
+  std::sort(iColVec.begin(), iColVec.end());
+  BuildBloomFilter(iColVec);
+  return true;
+}
+
+bool Table::DropBloomFilter(FieldID nPos) {
+  if (!HasBloomFilter(nPos)) return false;
+  std::vector<FieldID> iColVec = pTable->GetBloomColumns();
+  iColVec.erase(std::find(iColVec.begin(), iColVec.end(), nPos));
+  BuildBloomFilter(iColVec);
+  return true;
+}
+
+bool Table::HasBloomFilter(FieldID nPos) const {
+  std::vector<FieldID> iColVec = pTable->GetBloomColumns();
+  return std::find(iColVec.begin(), iColVec.end(), nPos) != iColVec.end();
+}
+
+Size Table::Serialize(VariableRecord *pRecord, std::vector<uint8_t> &iData,
+                      const std::vector<ToastPointer> &iKept) {
+  std::vector<ToastPointer> iExternal(iKept);
+  iExternal.resize(pRecord->GetSize(), ToastPointer{NULL_PAGE, 0});
+  std::vector<std::pair<Size, FieldID>> iStrVec;
+  for (FieldID i = 0; i < pRecord->GetSize(); ++i) {
+    Field *pField = pRecord->GetField(i);
+    if (pField->GetType() != FieldType::STRING_TYPE) continue;
+    if (iExternal[i].nPageID != NULL_PAGE) continue;
+    Size nSize = ((StringField *)pField)->GetString().size();
+    if (nSize > sizeof(ToastPointer)) iStrVec.push_back({nSize, i});
+  }
+  std::sort(iStrVec.rbegin(), iStrVec.rend());
+  Size nTotal = pRecord->GetTotSize(iExternal);
+  for (const auto &iStr : iStrVec) {
+    if (iStr.first <= TOAST_THRESHOLD &&
+        nTotal <= ToastPage::GetMaxRecordSize())
       break;
+    StringField *pField = (StringField *)pRecord->GetField(iStr.second);
+    String sValue = pField->GetString();
+    PageID nChain =
+        OverflowPage::WriteChain((const uint8_t *)sValue.data(), sValue.size());
+    iExternal[iStr.second] = ToastPointer{nChain, (Size)sValue.size()};
+    nTotal -= iStr.first - sizeof(ToastPointer);
+  }
+  if (iData.size() < nTotal) iData.resize(nTotal);
+  return pRecord->VarStore(iData.data(), iExternal);
+}
+
+void Table::CollectChains(const RecordView &iView,
+                          std::vector<PageID> &iChains) const {
+  for (FieldID i = 0; i < iView.GetSize(); ++i)
+    if (iView.GetType(i) == FieldType::STRING_TYPE && iView.IsExternal(i))
+      iChains.push_back(iView.GetExternal(i).nPageID);
+}
+
+std::vector<PageID> Table::GetChains(PageID nPageID, SlotID nSlotID) const {
+  std::vector<PageID> iChains;
+  if (!_bHasString) return iChains;
+  RecordView iView(pTable->GetTypeVec(), pTable->GetSizeVec());
+  PageSlotID iTarget;
+  {
+    ToastPage page(nPageID);
+    if (!page.IsRedirect(nSlotID)) {
+      iView.Reset(page.ViewRecord(nSlotID));
+      CollectChains(iView, iChains);
+      return iChains;
     }
+    iTarget = page.GetRedirect(nSlotID);
+  }
+  ToastPage page(iTarget.first);
+  iView.Reset(page.ViewRecord(iTarget.second));
+  CollectChains(iView, iChains);
+  return iChains;
+}
+
+Size Table::Vacuum(bool bMove,
+                  std::vector<std::pair<PageSlotID, PageSlotID>> &iMoves) {
+  BeginSummaryUpdate();
+  std::vector<PageID> iEmpty;
+  std::vector<std::pair<PageID, std::vector<SlotID>>> iSparse;
+  PageID nCur = _nHeadID;
+  while (nCur != NULL_PAGE) {
+    MiniOS::GetOS()->ReadAhead(nCur);
+    std::vector<SlotID> iSlots;
+    bool bSparse = false;
+    if (GetHomeSlots(nCur, iSlots, bSparse) == 0)
+      iEmpty.push_back(nCur);
+    else if (bSparse)
+      iSparse.push_back({nCur, iSlots});
     nCur = NextPageID(nCur);
   }
-  if (nCur == NULL_PAGE) {
-    ToastPage *newPage = new ToastPage();
-    ToastPage page(_nTailID);
-    page.PushBack(newPage);
-    pTable->SetTailID(newPage->GetPageID());
-    _nTailID = pTable->GetTailID();
-    _nNotFull = _nTailID;
-    delete newPage;
+  // 至少有两个稀疏页面时搬动才能减少页面数量
+  bool bMerge = bMove && iSparse.size() >= 2;
+  if (bMerge) {
+    // 待释放页面的剩余空间记为0，搬出的记录不会落入空页面或待搬空的页面
+    for (const auto &nPageID : iEmpty) _pFreeSpace->Update(nPageID, 0);
+    for (const auto &iPage : iSparse) _pFreeSpace->Update(iPage.first, 0);
+    for (const auto &iPage : iSparse) {
+      for (const auto &nSlot : iPage.second)
+        iMoves.push_back({PageSlotID(iPage.first, nSlot),
+                          MoveOut(iPage.first, nSlot)});
+      iEmpty.push_back(iPage.first);
+    }
+  }
+  Size nFreed = 0;
+  for (const auto &nPageID : iEmpty)
+    if (Unlink(nPageID)) ++nFreed;
+  if (nFreed > 0 || bMerge) RebuildSummaries();
+  _nNotFull = _nTailID;
+  pTable->SetDeletedCount(0);
+  return nFreed;
+}
+
+Size Table::GetDeletedCount() const { return pTable->GetDeletedCount(); }
+
+Size Table::GetHomeSlots(PageID nPageID, std::vector<SlotID> &iSlots,
+                         bool &bSparse) const {
+  Size nDataSize = MiniOS::GetOS()->GetDataSize();
+  if (_bColumnar) {
+    PaxPage page(nPageID, pTable->GetTypeVec(), pTable->GetSizeVec());
+    page.Scan(nullptr, iSlots);
+    bSparse = page.GetUsed() * 100 <= page.GetCap() * VACUUM_SPARSE_PERCENT;
+    return page.GetUsed();
+  }
+  if (_bFixed) {
+    RecordPage page(nPageID);
+    page.Scan(nullptr, iSlots);
+    bSparse = page.GetUsed() * 100 <= page.GetCap() * VACUUM_SPARSE_PERCENT;
+    return page.GetUsed();
+  }
+  ToastPage page(nPageID);
+  std::vector<SlotID> iRedirects;
+  page.Scan(nullptr, iSlots, iRedirects);
+  iSlots.insert(iSlots.end(), iRedirects.begin(), iRedirects.end());
+  // 剩余空间包括删除留下的空洞，存活数据为其余部分
+  bool bNoMoved = (iSlots.size() == page.GetUsed());
+  Size nLive = nDataSize - page.GetFreeSize();
+  bSparse = bNoMoved && nLive * 100 <= nDataSize * VACUUM_SPARSE_PERCENT;
+  return page.GetUsed();
+}
+
+PageSlotID Table::MoveOut(PageID nPageID, SlotID nSlotID) {
+  std::vector<uint8_t> iData;
+  if (_bColumnar) {
+    {
+      PaxPage page(nPageID, pTable->GetTypeVec(), pTable->GetSizeVec());
+      page.GetRecord(nSlotID, iData);
+      page.DeleteRecord(nSlotID);
+    }
+    NextNotFull(pTable->GetTotalSize());
+    PaxPage page(_nNotFull, pTable->GetTypeVec(), pTable->GetSizeVec());
+    PageSlotID iPair(_nNotFull, page.InsertRecord(iData.data()));
+    _pFreeSpace->Update(_nNotFull, page.GetFreeSize());
+    return iPair;
+  }
+  if (_bFixed) {
+    {
+      RecordPage page(nPageID);
+      const uint8_t *pData = page.ViewRecord(nSlotID);
+      iData.assign(pData, pData + pTable->GetFixedSize());
+      page.DeleteRecord(nSlotID);
+    }
+    NextNotFull(pTable->GetFixedSize());
+    RecordPage page(_nNotFull);
+    PageSlotID iPair(_nNotFull, page.InsertRecord(iData.data()));
+    _pFreeSpace->Update(_nNotFull, page.GetFreeSize());
+    return iPair;
+  }
+  PageSlotID iTarget(NULL_PAGE, 0);
+  {
+    ToastPage page(nPageID);
+    if (page.IsRedirect(nSlotID)) {
+      iTarget = page.GetRedirect(nSlotID);
+    } else {
+      const uint8_t *pData = page.ViewRecord(nSlotID);
+      iData.assign(pData, pData + page.GetRecordSize(nSlotID));
+    }
+    page.DeleteRecord(nSlotID);
+  }
+  // 迁出的记录直接搬到新位置，不再经由转发槽
+  if (iTarget.first != NULL_PAGE) {
+    ToastPage page(iTarget.first);
+    const uint8_t *pData = page.ViewRecord(iTarget.second);
+    iData.assign(pData, pData + page.GetRecordSize(iTarget.second));
+    page.DeleteRecord(iTarget.second);
+    _pFreeSpace->Update(iTarget.first, page.GetFreeSize());
+  }
+  NextNotFull(iData.size());
+  ToastPage page(_nNotFull);
+  PageSlotID iPair(_nNotFull, page.InsertRecord(iData.data(), iData.size()));
+  _pFreeSpace->Update(_nNotFull, page.GetFreeSize());
+  return iPair;
+}
+
+bool Table::Unlink(PageID nPageID) {
+  PageID nPrevID, nNextID;
+  {
+    LinkedPage page(nPageID);
+    nPrevID = page.GetPrevID();
+    nNextID = page.GetNextID();
+  }
+  if (nPrevID == NULL_PAGE && nNextID == NULL_PAGE) return false;
+  if (nPrevID == NULL_PAGE) {
+    // 摘除头页面时由下一个页面成为新的头页面
+    LinkedPage page(nNextID);
+    page.SetPrevID(NULL_PAGE);
+    MiniOS::GetOS()->DeletePage(nPageID);
+    pTable->SetHeadID(nNextID);
+  } else {
+    LinkedPage page(nPrevID);
+    page.PopBack();
+    if (nNextID == NULL_PAGE) pTable->SetTailID(nPrevID);
+  }
+  _nHeadID = pTable->GetHeadID();
+  _nTailID = pTable->GetTailID();
+  return true;
+}
+
+void Table::RebuildSummaries() {
+  _pFreeSpace->Clear();
+  delete _pFreeSpace;
+  BuildFreeSpace();
+  if (_pZoneMap) {
+    _pZoneMap->Clear();
+    delete _pZoneMap;
+    _pZoneMap = nullptr;
+    BuildZoneMap();
   }
+  // 重新构建时删除的记录不再计入摘要，范围和过滤器随之收紧
+  if (_pBloomFilter) BuildBloomFilter(pTable->GetBloomColumns());
 }
 
 FieldID Table::GetPos(const String &sCol) const { return pTable->GetPos(sCol); }
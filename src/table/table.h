@@ -5,8 +5,13 @@
 #include "defines.h"
 #include "page/table_page.h"
 #include "record/record.h"
+#include "record/record_view.h"
 #include "record/transform.h"
+#include "record/variable_record.h"
+#include "table/bloom_filter.h"
+#include "table/free_space_map.h"
 #include "table/schema.h"
+#include "table/zone_map.h"
 
 namespace thdb {
 
@@ -23,6 +28,12 @@ class Table {
    * @return Record* 对应记录
    */
   Record *GetRecord(PageID nPageID, SlotID nSlotID);
+  /**
+   * @brief 获取一个指定位置的记录，只从溢出页面链读回iDetoast中的字段，
+   * 其余溢出存放的字段内容为空
+   */
+  Record *GetRecord(PageID nPageID, SlotID nSlotID,
+                    const std::vector<FieldID> &iDetoast);
   /**
    * @brief 插入一条数据
    *
@@ -30,6 +41,15 @@ class Table {
    * @return PageSlotID 插入的位置
    */
   PageSlotID InsertRecord(Record *pRecord);
+  /**
+   * @brief 批量插入数据。
+   * 所有记录复用同一个序列化缓冲区，当前页面放满后才切换到下一个页面，
+   * 每个页面在整批插入中只打开和写回一次。
+   *
+   * @param iRecordVec 待插入数据
+   * @return std::vector<PageSlotID> 各条数据插入的位置
+   */
+  std::vector<PageSlotID> InsertBatch(const std::vector<Record *> &iRecordVec);
   /**
    * @brief 删除一条数据
    *
@@ -43,6 +63,9 @@ class Table {
    * @param nPageID 页编号
    * @param nSlotID 槽编号
    * @param iTrans 更新变化方式
+   *
+   * 记录的位置在更新后保持不变。变长后原页面放不下时，
+   * 记录迁出到其他页面，原始槽改写为转发槽。
    */
   void UpdateRecord(PageID nPageID, SlotID nSlotID,
                     const std::vector<Transform> &iTrans);
@@ -73,7 +96,41 @@ class Table {
 
   std::vector<String> GetColumnNames() const;
 
+  /**
+   * @brief 为整数列建立按页面的布隆过滤器，并加入表中已有的记录
+   *
+   * @return false 该列不是整数列、已经建立了过滤器，
+   * 或加入后一个摘要页面放不下一个数据页面的全部过滤器
+   */
+  bool AddBloomFilter(FieldID nPos);
+  /**
+   * @brief 删除列上的布隆过滤器
+   *
+   * @return false 该列没有建立过滤器
+   */
+  bool DropBloomFilter(FieldID nPos);
+  bool HasBloomFilter(FieldID nPos) const;
+
+  /**
+   * @brief 整理表的数据页面。
+   * 存活数据不超过VACUUM_SPARSE_PERCENT的页面中的记录搬入其他页面，
+   * 随后从页面链表中摘除并释放所有空页面，
+   * 最后重新构建空闲空间映射、区域映射和布隆过滤器。
+   * 存放其他页面迁出记录的页面不会被搬空。
+   *
+   * @param bMove 是否允许搬动记录，为false时只释放空页面
+   * @param iMoves 追加被搬动记录的原位置和新位置
+   * @return Size 释放的页面数量
+   */
+  Size Vacuum(bool bMove,
+              std::vector<std::pair<PageSlotID, PageSlotID>> &iMoves);
+  /**
+   * @brief 获得上次整理以来删除的记录数量
+   */
+  Size GetDeletedCount() const;
+
  private:
+  friend class TableScanCursor;
   TablePage *pTable;
   PageID _nHeadID;
   PageID _nTailID;
@@ -81,12 +138,139 @@ class Table {
    * @brief 表示一个非满页编号，可用于构建一个时空高效的记录插入算法。
    */
   PageID _nNotFull;
-
+  /**
+   * @brief 表的空闲空间映射，用于快速查找能容纳新记录的页面
+   */
+  FreeSpaceMap *_pFreeSpace;
+  /**
+   * @brief 表的区域映射，用于在扫描时跳过不可能满足条件的页面，
+   * 表中没有数值列时为nullptr
+   */
+  ZoneMap *_pZoneMap;
+  /**
+   * @brief 表的布隆过滤器，没有列建立过滤器时为nullptr
+   */
+  BloomFilter *_pBloomFilter;
+  /**
+   * @brief 表中是否有字符串列，没有时记录不可能引用溢出页面
+   */
+  bool _bHasString;
+  /**
+   * @brief 表是否使用PAX列式布局
+   */
+  bool _bColumnar;
+  /**
+   * @brief 表是否使用定长记录页面，记录按槽编号直接定位
+   */
+  bool _bFixed;
   /**
    * @brief 查找一个可用于插入新记录的页面，不存在时自动添加一个新的页面
    *
    */
   void NextNotFull(const PageOffset len);
+  /**
+   * @brief 判断数据页面能否容纳一条长度为len的新记录，并获得其剩余空间
+   */
+  bool PageFits(PageID nPageID, PageOffset len, PageOffset &nFree) const;
+  /**
+   * @brief 列式布局表的批量插入，各页面同样只打开和写回一次
+   */
+  std::vector<PageSlotID> InsertPax(const std::vector<Record *> &iRecordVec);
+  /**
+   * @brief 定长布局表的批量插入，记录直接序列化为定长格式
+   */
+  std::vector<PageSlotID> InsertFixed(const std::vector<Record *> &iRecordVec);
+  /**
+   * @brief 读出一条记录，含义与VariableRecord::VarLoad相同
+   */
+  VariableRecord *LoadRecord(PageID nPageID, SlotID nSlotID,
+                             const std::vector<FieldID> &iDetoast,
+                             std::vector<ToastPointer> &iExternal);
+  /**
+   * @brief 将更新后的记录写回原始槽，放不下时迁出到其他页面并留下转发槽
+   */
+  void StoreUpdated(PageID nPageID, SlotID nSlotID, const uint8_t *src,
+                    PageOffset len);
+  /**
+   * @brief 在指定页面内更新一条记录，页面放不下时返回false且不做修改
+   */
+  bool UpdateInPage(PageID nPageID, SlotID nSlotID, const uint8_t *src,
+                    PageOffset len);
+  /**
+   * @brief 扫描页面链表，为尚未建立空闲空间映射的表构建映射
+   */
+  void BuildFreeSpace();
+  /**
+   * @brief 扫描全部记录，为尚未建立区域映射的表构建映射
+   */
+  void BuildZoneMap();
+  /**
+   * @brief 按给定的列重新构建布隆过滤器，列为空时删除过滤器
+   */
+  void BuildBloomFilter(const std::vector<FieldID> &iColVec);
+  /**
+   * @brief 为新加入表的数据页面增加区域映射和布隆过滤器的记录
+   */
+  void AppendSummary(PageID nHeapID);
+  /**
+   * @brief 将一条记录并入其原始页面的区域映射和布隆过滤器
+   */
+  void Summarize(PageID nHeapID, const uint8_t *pData);
+  /**
+   * @brief 修改数据页面前将区域映射和布隆过滤器标记为可能过期，
+   * 并只同步写回表页面。摘要页面延迟写回，崩溃后可能比数据页面窄，
+   * 标记保证下次打开时重新构建。
+   */
+  void BeginSummaryUpdate();
+  /**
+   * @brief 判断扫描能否跳过数据页面
+   *
+   * @param nNextID 可以跳过时为页面链表中的下一个页面
+   */
+  bool SkipPage(PageID nHeapID, const RecordFilter &iFilter,
+                PageID &nNextID) const;
+  /**
+   * @brief 获得数据页面上原始位置在本页的记录，判断页面能否被搬空
+   *
+   * @param iSlots 原始位置在本页的记录，包括转发槽
+   * @param bSparse 页面足够稀疏且没有存放其他页面迁出的记录
+   * @return Size 页面上已使用的槽数量
+   */
+  Size GetHomeSlots(PageID nPageID, std::vector<SlotID> &iSlots,
+                    bool &bSparse) const;
+  /**
+   * @brief 将一条记录搬到其他页面，不改变记录引用的溢出页面链
+   */
+  PageSlotID MoveOut(PageID nPageID, SlotID nSlotID);
+  /**
+   * @brief 从页面链表中摘除并释放一个数据页面，表只剩这一个页面时不摘除
+   */
+  bool Unlink(PageID nPageID);
+  /**
+   * @brief 页面链表改变后重新构建空闲空间映射、区域映射和布隆过滤器
+   */
+  void RebuildSummaries();
+  /**
+   * @brief 序列化一条记录。
+   * 超过TOAST_THRESHOLD的字符串写入溢出页面链，记录仍超过一个页面的容量时
+   * 再从最长的字符串开始继续移出。
+   *
+   * @param iData 序列化结果，长度不足时自动扩展
+   * @param iKept 沿用原有溢出页面链的字段，含义与VarLoad得到的溢出指针相同
+   * @return Size 序列化后的记录长度
+   */
+  Size Serialize(VariableRecord *pRecord, std::vector<uint8_t> &iData,
+                 const std::vector<ToastPointer> &iKept =
+                     std::vector<ToastPointer>());
+  /**
+   * @brief 收集记录引用的溢出页面链
+   */
+  void CollectChains(const RecordView &iView,
+                     std::vector<PageID> &iChains) const;
+  /**
+   * @brief 获得指定位置记录引用的溢出页面链，转发槽按其目标记录处理
+   */
+  std::vector<PageID> GetChains(PageID nPageID, SlotID nSlotID) const;
 };
 
 }  // namespace thdb
@@ -0,0 +1,158 @@
+#include "table/table_scan_cursor.h"
+
+#include "macros.h"
+#include "minios/os.h"
+#include "page/pax_page.h"
+#include "page/record_page.h"
+#include "page/toast_page.h"
+#include "table/table.h"
+
+namespace thdb {
+
+TableScanCursor::TableScanCursor(Table *pTable, Condition *pCond)
+    : _pTable(pTable),
+      _pCond(pCond),
+      _nNextID(pTable->_nHeadID),
+      _pFilter(nullptr),
+      _pRecord(nullptr),
+      _iView(pTable->pTable->GetTypeVec(), pTable->pTable->GetSizeVec()),
+      _nPos(-1) {
+  if (_pCond) {
+    _pFilter = new RecordFilter(pTable->pTable->GetTypeVec(),
+                                pTable->pTable->GetSizeVec());
+    if (!_pCond->Compile(_pFilter)) {
+      delete _pFilter;
+      _pFilter = nullptr;
+    }
+  }
+}
+
+TableScanCursor::~TableScanCursor() {
+  ClearBatch();
+  if (_pFilter) delete _pFilter;
+}
+
+void TableScanCursor::ClearBatch() {
+  if (_pRecord) delete _pRecord;
+  _pRecord = nullptr;
+  _iBuffer.clear();
+  _iOffsets.clear();
+  _iPairs.clear();
+  _nPos = -1;
+}
+
+bool TableScanCursor::LoadPage() {
+  ClearBatch();
+  while (_nNextID != NULL_PAGE && _iPairs.empty()) {
+    PageID nPageID = _nNextID;
+    // 页面摘要表明页面上不可能有满足条件的记录时，不打开页面直接跳过
+    if (_pFilter && _pTable->SkipPage(nPageID, *_pFilter, _nNextID)) continue;
+    MiniOS::GetOS()->ReadAhead(nPageID);
+    if (_pTable->_bColumnar) {
+      LoadPaxPage(nPageID);
+      continue;
+    }
+    if (_pTable->_bFixed) {
+      LoadFixedPage(nPageID);
+      continue;
+    }
+    std::vector<std::pair<PageSlotID, PageSlotID>> iForwards;
+    {
+      ToastPage page(nPageID);
+      // 可编译的条件在页面字节上求值，否则回退到在记录视图上判断
+      _iSlots.clear();
+      _iRedirects.clear();
+      page.Scan(_pFilter, _iSlots, _iRedirects);
+      for (const auto &nSlot : _iSlots)
+        Collect(page.ViewRecord(nSlot), page.GetRecordSize(nSlot),
+                PageSlotID(nPageID, nSlot));
+      for (const auto &nSlot : _iRedirects)
+        iForwards.push_back(
+            {page.GetRedirect(nSlot), PageSlotID(nPageID, nSlot)});
+      _nNextID = page.GetNextID();
+    }
+    // 关闭当前页面后再读取迁出的记录，过滤器同样直接作用于页面字节
+    for (const auto &iForward : iForwards) {
+      ToastPage page(iForward.first.first);
+      const uint8_t *pData = page.ViewRecord(iForward.first.second);
+      if (_pFilter && !_pFilter->Match(pData)) continue;
+      Collect(pData, page.GetRecordSize(iForward.first.second),
+              iForward.second);
+    }
+  }
+  return !_iPairs.empty();
+}
+
+void TableScanCursor::LoadPaxPage(PageID nPageID) {
+  PaxPage page(nPageID, _pTable->pTable->GetTypeVec(),
+               _pTable->pTable->GetSizeVec());
+  // 过滤器逐列求值，只有满足条件的记录才从各列小页中拼出
+  _iSlots.clear();
+  page.Scan(_pFilter, _iSlots);
+  for (const auto &nSlot : _iSlots) {
+    Size nBegin = _iBuffer.size();
+    page.GetRecord(nSlot, _iBuffer);
+    if (_pCond && !_pFilter) {
+      _iView.Reset(_iBuffer.data() + nBegin);
+      if (!_pCond->Match(_iView)) {
+        _iBuffer.resize(nBegin);
+        continue;
+      }
+    }
+    _iOffsets.push_back(nBegin);
+    _iPairs.push_back(PageSlotID(nPageID, nSlot));
+  }
+  _nNextID = page.GetNextID();
+}
+
+void TableScanCursor::LoadFixedPage(PageID nPageID) {
+  RecordPage page(nPageID);
+  // 定长记录没有转发槽，槽位置由槽编号算出，过滤器直接作用于页面字节
+  _iSlots.clear();
+  page.Scan(_pFilter, _iSlots);
+  Size nFixed = _pTable->pTable->GetFixedSize();
+  for (const auto &nSlot : _iSlots)
+    Collect(page.ViewRecord(nSlot), nFixed, PageSlotID(nPageID, nSlot));
+  _nNextID = page.GetNextID();
+}
+
+void TableScanCursor::Collect(const uint8_t *pData, Size nLen,
+                              const PageSlotID &iPair) {
+  if (_pCond && !_pFilter) {
+    _iView.Reset(pData);
+    if (!_pCond->Match(_iView)) return;
+  }
+  _iOffsets.push_back(_iBuffer.size());
+  _iBuffer.insert(_iBuffer.end(), pData, pData + nLen);
+  _iPairs.push_back(iPair);
+}
+
+bool TableScanCursor::Next() {
+  if (_pRecord) delete _pRecord;
+  _pRecord = nullptr;
+  if (_nPos + 1 < (int)_iPairs.size()) {
+    ++_nPos;
+  } else {
+    if (!LoadPage()) return false;
+    _nPos = 0;
+  }
+  _iView.Reset(_iBuffer.data() + _iOffsets[_nPos]);
+  return true;
+}
+
+PageSlotID TableScanCursor::GetPageSlotID() const { return _iPairs[_nPos]; }
+
+const RecordView &TableScanCursor::GetView() const { return _iView; }
+
+Record *TableScanCursor::GetRecord() {
+  if (!_pRecord) _pRecord = _iView.ToRecord();
+  return _pRecord;
+}
+
+Record *TableScanCursor::TakeRecord() {
+  Record *pRecord = GetRecord();
+  _pRecord = nullptr;
+  return pRecord;
+}
+
+}  // namespace thdb
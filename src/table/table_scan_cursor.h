@@ -0,0 +1,109 @@
+#ifndef THDB_TABLE_SCAN_CURSOR_H_
+#define THDB_TABLE_SCAN_CURSOR_H_
+
+#include <vector>
+
+#include "condition/condition.h"
+#include "defines.h"
+#include "record/record.h"
+#include "record/record_filter.h"
+#include "record/record_view.h"
+
+namespace thdb {
+
+class Table;
+
+/**
+ * @brief 表的顺序扫描游标。
+ * 按页面链表顺序逐页扫描，每次只打开一个页面，
+ * 条件编译为字节级过滤器后在页面数据上求值，
+ * 只复制满足条件的记录，随后立即关闭页面。
+ * 完整的Record仅在调用GetRecord时才解码，只需要位置的使用者不产生解码开销。
+ * 返回记录前当前页面已经关闭，使用者可以删除或更新刚刚返回的记录。
+ * 迁出的记录经由原始槽上的转发槽读取，返回原始位置，每行只出现一次。
+ * 表的区域映射或布隆过滤器表明页面不可能包含满足条件的记录时，
+ * 整个页面被跳过。
+ */
+class TableScanCursor {
+ public:
+  /**
+   * @param pTable 扫描的表
+   * @param pCond 过滤条件，为nullptr时返回全部记录
+   */
+  TableScanCursor(Table *pTable, Condition *pCond);
+  ~TableScanCursor();
+  TableScanCursor(const TableScanCursor &) = delete;
+  TableScanCursor &operator=(const TableScanCursor &) = delete;
+
+  /**
+   * @brief 移动到下一条满足条件的记录
+   *
+   * @return true 存在下一条记录
+   * @return false 扫描结束
+   */
+  bool Next();
+  /**
+   * @brief 获得当前记录的位置
+   */
+  PageSlotID GetPageSlotID() const;
+  /**
+   * @brief 获得当前记录的视图，在下一次Next后失效
+   */
+  const RecordView &GetView() const;
+  /**
+   * @brief 获得当前记录，首次调用时解码，记录由游标所有，在下一次Next后失效
+   */
+  Record *GetRecord();
+  /**
+   * @brief 取走当前记录，之后由调用者负责析构
+   */
+  Record *TakeRecord();
+
+ private:
+  /**
+   * @brief 读取下一个页面中满足条件的记录，返回false表示没有更多页面
+   */
+  bool LoadPage();
+  void ClearBatch();
+  /**
+   * @brief 检查一条记录是否满足条件，满足时复制到当前批次
+   */
+  void Collect(const uint8_t *pData, Size nLen, const PageSlotID &iPair);
+  /**
+   * @brief 读取列式布局表的一个页面
+   */
+  void LoadPaxPage(PageID nPageID);
+  /**
+   * @brief 读取定长布局表的一个页面
+   */
+  void LoadFixedPage(PageID nPageID);
+
+  Table *_pTable;
+  Condition *_pCond;
+  PageID _nNextID;
+  /**
+   * @brief 由检索条件编译出的过滤器，条件无法编译时为nullptr
+   */
+  RecordFilter *_pFilter;
+  std::vector<SlotID> _iSlots;
+  std::vector<SlotID> _iRedirects;
+  /**
+   * @brief 当前批次记录的序列化数据，按记录顺序连续存放
+   */
+  std::vector<uint8_t> _iBuffer;
+  std::vector<Size> _iOffsets;
+  std::vector<PageSlotID> _iPairs;
+  /**
+   * @brief 已解码的记录，未解码时为nullptr
+   */
+  Record *_pRecord;
+  RecordView _iView;
+  /**
+   * @brief 当前记录在批次中的下标，批次开始前为-1
+   */
+  int _nPos;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_TABLE_SCAN_CURSOR_H_
@@ -0,0 +1,109 @@
+#include "table/zone_map.h"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "macros.h"
+
+namespace thdb {
+
+const double ZONE_INF = std::numeric_limits<double>::infinity();
+
+Size ZoneColumns(const std::vector<FieldType> &iTypeVec) {
+  Size nColumns = 0;
+  for (const auto &iType : iTypeVec)
+    if (iType == FieldType::INT_TYPE || iType == FieldType::FLOAT_TYPE)
+      ++nColumns;
+  return nColumns;
+}
+
+/**
+ * @brief 以一个数据页面各列的取值范围作为概要
+ */
+class ZoneProbe : public RangeProbe {
+ public:
+  ZoneProbe(const double *pBound, const std::vector<int> &iIndexVec)
+      : _pBound(pBound), _iIndexVec(iIndexVec) {}
+
+  bool MayInRange(FieldID nPos, double fLow, double fHigh, bool bInt,
+                  bool &bMust) const override {
+    bMust = false;
+    if (_iIndexVec[nPos] < 0) return true;
+    double fMin = _pBound[2 * _iIndexVec[nPos]];
+    double fMax = _pBound[2 * _iIndexVec[nPos] + 1];
+    // 空范围上没有记录可能满足，同时视为所有记录都满足
+    bMust = (fMin >= fLow) && (fMax < fHigh);
+    return (fMax >= fLow) && (fMin < fHigh);
+  }
+
+ private:
+  const double *_pBound;
+  const std::vector<int> &_iIndexVec;
+};
+
+ZoneMap::ZoneMap(PageID nOwner, PageID nFirstID,
+                 const std::vector<FieldType> &iTypeVec,
+                 const std::vector<Size> &iSizeVec)
+    : PageSummary(nOwner, nFirstID,
+                  2 * sizeof(double) * ZoneColumns(iTypeVec)),
+      _iIndexVec(iTypeVec.size(), -1),
+      _iView(iTypeVec, iSizeVec) {
+  for (FieldID i = 0; i < iTypeVec.size(); ++i) {
+    if (iTypeVec[i] != FieldType::INT_TYPE &&
+        iTypeVec[i] != FieldType::FLOAT_TYPE)
+      continue;
+    _iIndexVec[i] = _iColVec.size();
+    _iColVec.push_back(i);
+  }
+}
+
+bool ZoneMap::HasNumeric(const std::vector<FieldType> &iTypeVec) {
+  return ZoneColumns(iTypeVec) > 0;
+}
+
+void ZoneMap::InitEntry(uint8_t *pEntry) const {
+  // 空范围的最小值大于最大值，任何条件都不会与之相交
+  for (Size i = 0; i < _iColVec.size(); ++i) {
+    double iEmpty[2] = {ZONE_INF, -ZONE_INF};
+    memcpy(pEntry + sizeof(iEmpty) * i, iEmpty, sizeof(iEmpty));
+  }
+}
+
+void ZoneMap::Widen(PageID nHeapID, const uint8_t *pData) {
+  double *pBound = (double *)GetMutableEntry(nHeapID);
+  if (pBound == nullptr) return;
+  bool bChanged = false;
+  _iView.Reset(pData);
+  for (Size i = 0; i < _iColVec.size(); ++i) {
+    FieldID nCol = _iColVec[i];
+    double fData = (_iView.GetType(nCol) == FieldType::INT_TYPE)
+                       ? _iView.GetInt(nCol)
+                       : _iView.GetFloat(nCol);
+    double &fMin = pBound[2 * i], &fMax = pBound[2 * i + 1];
+    if (std::isnan(fData)) {
+      // NaN不满足任何范围但满足范围的否定，只能放弃该列的范围
+      bChanged |= (fMin != -ZONE_INF) || (fMax != ZONE_INF);
+      fMin = -ZONE_INF;
+      fMax = ZONE_INF;
+      continue;
+    }
+    if (fData < fMin) {
+      fMin = fData;
+      bChanged = true;
+    }
+    if (fData > fMax) {
+      fMax = fData;
+      bChanged = true;
+    }
+  }
+  if (bChanged) SetDirty(nHeapID);
+}
+
+bool ZoneMap::MayMatch(PageID nHeapID, const RecordFilter &iFilter) const {
+  const double *pBound = (const double *)GetEntry(nHeapID);
+  if (pBound == nullptr) return true;
+  return iFilter.MayMatch(ZoneProbe(pBound, _iIndexVec));
+}
+
+}  // namespace thdb
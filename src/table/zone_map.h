@@ -0,0 +1,67 @@
+#ifndef THDB_ZONE_MAP_H_
+#define THDB_ZONE_MAP_H_
+
+#include <vector>
+
+#include "defines.h"
+#include "field/field.h"
+#include "record/record_filter.h"
+#include "record/record_view.h"
+#include "table/page_summary.h"
+
+namespace thdb {
+
+/**
+ * @brief 表的区域映射。
+ * 为表中每个数据页面记录各数值列的最小值和最大值。
+ * 插入和更新只扩大范围，删除不收缩，范围总是覆盖页面上的所有记录，
+ * 扫描时可以安全地跳过范围与条件不相交的页面。
+ */
+class ZoneMap : public PageSummary {
+ public:
+  /**
+   * @brief 导入以nFirstID开始的区域映射，nFirstID为NULL_PAGE时构建空映射
+   *
+   * @param nOwner 所属表的页面编号，新的映射页面在该表的区段中分配
+   * @param nFirstID 第一个映射页面的编号
+   */
+  ZoneMap(PageID nOwner, PageID nFirstID,
+          const std::vector<FieldType> &iTypeVec,
+          const std::vector<Size> &iSizeVec);
+  ~ZoneMap() = default;
+
+  /**
+   * @brief 将一条记录的取值并入数据页面的范围
+   *
+   * @param nHeapID 记录原始位置所在的数据页面编号
+   * @param pData VariableRecord::VarStore格式的记录数据
+   */
+  void Widen(PageID nHeapID, const uint8_t *pData);
+  /**
+   * @brief 判断数据页面上是否可能存在满足过滤器的记录，未记录的页面总是返回true
+   */
+  bool MayMatch(PageID nHeapID, const RecordFilter &iFilter) const;
+
+  /**
+   * @brief 判断表中是否有可以记录范围的数值列
+   */
+  static bool HasNumeric(const std::vector<FieldType> &iTypeVec);
+
+ protected:
+  void InitEntry(uint8_t *pEntry) const override;
+
+ private:
+  /**
+   * @brief 记录范围的数值列
+   */
+  std::vector<FieldID> _iColVec;
+  /**
+   * @brief 表中每一列在_iColVec中的下标，非数值列为-1
+   */
+  std::vector<int> _iIndexVec;
+  RecordView _iView;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_ZONE_MAP_H_
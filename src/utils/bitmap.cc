@@ -4,30 +4,49 @@
 
 namespace thdb {
 
+const uint64_t FULL_WORD = ~0ULL;
+
+inline Size WordCount(Size nBits) { return (nBits + 63) / 64; }
+
 Bitmap::Bitmap(Size size) {
-  _pBits = new uint8_t[(size - 1) / 8 + 1];
-  memset(_pBits, 0, (size - 1) / 8 + 1);
   _nSize = size;
+  _nWords = WordCount(size);
+  _nGroups = WordCount(_nWords);
+  _nTops = WordCount(_nGroups);
+  _pBits = new uint64_t[_nWords];
+  _pFullWords = new uint64_t[_nGroups];
+  _pFullGroups = new uint64_t[_nTops];
+  memset(_pBits, 0, _nWords * sizeof(uint64_t));
+  memset(_pFullWords, 0, _nGroups * sizeof(uint64_t));
+  memset(_pFullGroups, 0, _nTops * sizeof(uint64_t));
   _nUsed = 0;
 }
 
-Bitmap::~Bitmap() { delete[] _pBits; }
+Bitmap::~Bitmap() {
+  delete[] _pBits;
+  delete[] _pFullWords;
+  delete[] _pFullGroups;
+}
 
 void Bitmap::Set(Size pos) {
   if (!Get(pos)) {
-    _pBits[pos >> 3] |= (1 << (pos & 7));
+    _pBits[pos >> 6] |= (1ULL << (pos & 63));
     ++_nUsed;
+    Refresh(pos >> 6);
   }
 }
 
 void Bitmap::Unset(Size pos) {
   if (Get(pos)) {
-    _pBits[pos >> 3] &= ~(1 << (pos & 7));
+    _pBits[pos >> 6] &= ~(1ULL << (pos & 63));
     --_nUsed;
+    Refresh(pos >> 6);
   }
 }
 
-bool Bitmap::Get(Size pos) const { return _pBits[pos >> 3] & (1 << (pos & 7)); }
+bool Bitmap::Get(Size pos) const {
+  return _pBits[pos >> 6] & (1ULL << (pos & 63));
+}
 
 Size Bitmap::GetSize() const { return _nSize; }
 
@@ -37,14 +56,79 @@ bool Bitmap::Empty() const { return _nUsed == 0; }
 
 bool Bitmap::Full() const { return _nUsed == _nSize; }
 
-void Bitmap::Load(const uint8_t *pBits) {
-  memcpy(_pBits, pBits, (_nSize - 1) / 8 + 1);
-  for (Size i = 0; i < _nSize; ++i)
-    if (Get(i)) ++_nUsed;
+void Bitmap::Load(const uint8_t *pBits) { Load(pBits, (_nSize + 7) / 8); }
+
+void Bitmap::Load(const uint8_t *pBits, Size nBytes) {
+  memset(_pBits, 0, _nWords * sizeof(uint64_t));
+  memcpy(_pBits, pBits, nBytes);
+  // 超出位图大小的尾部位不计入使用量
+  if (_nSize & 63) _pBits[_nWords - 1] &= (1ULL << (_nSize & 63)) - 1;
+  _nUsed = 0;
+  for (Size i = 0; i < _nWords; ++i) _nUsed += __builtin_popcountll(_pBits[i]);
+  Rebuild();
 }
 
 void Bitmap::Store(uint8_t *pBits) {
-  memcpy(pBits, _pBits, (_nSize - 1) / 8 + 1);
+  memcpy(pBits, _pBits, (_nSize + 7) / 8);
+}
+
+void Bitmap::Store(uint8_t *pBits, Size nByteOffset, Size nBytes) {
+  memcpy(pBits, (uint8_t *)_pBits + nByteOffset, nBytes);
+}
+
+Size Bitmap::FirstFree() const {
+  // 尾部填充位恒为0，找到的位置超出范围即说明有效位均已置位
+  for (Size nTop = 0; nTop < _nTops; ++nTop) {
+    if (_pFullGroups[nTop] == FULL_WORD) continue;
+    Size nGroup = nTop * 64 + __builtin_ctzll(~_pFullGroups[nTop]);
+    if (nGroup >= _nGroups) return _nSize;
+    Size nWord = nGroup * 64 + __builtin_ctzll(~_pFullWords[nGroup]);
+    if (nWord >= _nWords) return _nSize;
+    Size nPos = nWord * 64 + __builtin_ctzll(~_pBits[nWord]);
+    return (nPos < _nSize) ? nPos : _nSize;
+  }
+  return _nSize;
+}
+
+Size Bitmap::FreeRun(Size nRun, Size nHint) const {
+  uint64_t nMask = (nRun >= 64) ? FULL_WORD : ((1ULL << nRun) - 1);
+  if (nHint % nRun == 0 && nHint + nRun <= _nSize &&
+      !((_pBits[nHint >> 6] >> (nHint & 63)) & nMask))
+    return nHint;
+  for (Size nWord = FirstFree() >> 6; nWord < _nWords; ++nWord) {
+    uint64_t nBits = _pBits[nWord];
+    if (nBits == FULL_WORD) continue;
+    for (Size nOffset = 0; nOffset < 64; nOffset += nRun) {
+      if ((nBits >> nOffset) & nMask) continue;
+      Size nPos = nWord * 64 + nOffset;
+      return (nPos + nRun <= _nSize) ? nPos : _nSize;
+    }
+  }
+  return _nSize;
+}
+
+void Bitmap::Refresh(Size nWord) {
+  Size nGroup = nWord >> 6;
+  if (_pBits[nWord] == FULL_WORD) {
+    _pFullWords[nGroup] |= (1ULL << (nWord & 63));
+  } else {
+    _pFullWords[nGroup] &= ~(1ULL << (nWord & 63));
+  }
+  if (_pFullWords[nGroup] == FULL_WORD) {
+    _pFullGroups[nGroup >> 6] |= (1ULL << (nGroup & 63));
+  } else {
+    _pFullGroups[nGroup >> 6] &= ~(1ULL << (nGroup & 63));
+  }
+}
+
+void Bitmap::Rebuild() {
+  memset(_pFullWords, 0, _nGroups * sizeof(uint64_t));
+  memset(_pFullGroups, 0, _nTops * sizeof(uint64_t));
+  for (Size i = 0; i < _nWords; ++i)
+    if (_pBits[i] == FULL_WORD) _pFullWords[i >> 6] |= (1ULL << (i & 63));
+  for (Size i = 0; i < _nGroups; ++i)
+    if (_pFullWords[i] == FULL_WORD)
+      _pFullGroups[i >> 6] |= (1ULL << (i & 63));
 }
 
 }  // namespace thdb
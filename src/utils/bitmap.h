@@ -21,10 +21,52 @@ class Bitmap {
   bool Full() const;
   bool Empty() const;
   void Load(const uint8_t *pBits);
+  /**
+   * @brief 导入位图的前nBytes个字节，其余部分保持为0
+   */
+  void Load(const uint8_t *pBits, Size nBytes);
   void Store(uint8_t *pBits);
+  /**
+   * @brief 导出位图中从第nByteOffset个字节开始的nBytes个字节
+   */
+  void Store(uint8_t *pBits, Size nByteOffset, Size nBytes);
+  /**
+   * @brief 查找编号最小的未置位位置，借助两级摘要在常数次字操作内完成
+   *
+   * @return Size 未置位位置，位图已满时返回GetSize()
+   */
+  Size FirstFree() const;
+  /**
+   * @brief 查找按nRun对齐的连续nRun个未置位位置，优先使用nHint处的区段
+   *
+   * @param nRun 区段长度，须为不超过64的2的幂
+   * @param nHint 期望的区段起点
+   * @return Size 区段起点，不存在时返回GetSize()
+   */
+  Size FreeRun(Size nRun, Size nHint) const;
 
  private:
-  uint8_t *_pBits;
+  /**
+   * @brief 第nWord个字发生变化后更新两级摘要
+   */
+  void Refresh(Size nWord);
+  void Rebuild();
+
+  /**
+   * @brief 位数据按64位字存放，小端序下字节布局与按字节存放时一致
+   */
+  uint64_t *_pBits;
+  /**
+   * @brief 一级摘要：第i位表示_pBits[i]是否已满
+   */
+  uint64_t *_pFullWords;
+  /**
+   * @brief 二级摘要：第i位表示_pFullWords[i]是否已满
+   */
+  uint64_t *_pFullGroups;
+  Size _nWords;
+  Size _nGroups;
+  Size _nTops;
   Size _nSize;
   Size _nUsed;
 };
@@ -0,0 +1,29 @@
+#include "utils/string_view.h"
+
+#include <cstring>
+
+namespace thdb {
+
+StringView::StringView() : _pData(nullptr), _nSize(0) {}
+
+StringView::StringView(const char *pData, Size nSize)
+    : _pData(pData), _nSize(nSize) {}
+
+const char *StringView::GetData() const { return _pData; }
+
+Size StringView::GetSize() const { return _nSize; }
+
+String StringView::ToString() const { return String(_pData, _nSize); }
+
+bool operator==(const StringView &a, const StringView &b) {
+  return a.GetSize() == b.GetSize() &&
+         memcmp(a.GetData(), b.GetData(), a.GetSize()) == 0;
+}
+
+bool operator<(const StringView &a, const StringView &b) {
+  Size nSize = (a.GetSize() < b.GetSize()) ? a.GetSize() : b.GetSize();
+  int nCmp = memcmp(a.GetData(), b.GetData(), nSize);
+  return (nCmp != 0) ? (nCmp < 0) : (a.GetSize() < b.GetSize());
+}
+
+}  // namespace thdb
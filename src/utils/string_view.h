@@ -0,0 +1,33 @@
+#ifndef THDB_STRING_VIEW_H_
+#define THDB_STRING_VIEW_H_
+
+#include "defines.h"
+
+namespace thdb {
+
+/**
+ * @brief 不持有数据的字符串视图，指向页面或缓冲区中的字节
+ */
+class StringView {
+ public:
+  StringView();
+  StringView(const char *pData, Size nSize);
+
+  const char *GetData() const;
+  Size GetSize() const;
+  /**
+   * @brief 复制为String
+   */
+  String ToString() const;
+
+ private:
+  const char *_pData;
+  Size _nSize;
+};
+
+bool operator==(const StringView &a, const StringView &b);
+bool operator<(const StringView &a, const StringView &b);
+
+}  // namespace thdb
+
+#endif  // THDB_STRING_VIEW_H_